@@ -0,0 +1,731 @@
+/**
+ * @file bench_main.c
+ * @brief Benchmark file of the project.
+ *
+ * The file contains the throughput benchmark of the PRESENT cipher project.
+ * Every available engine encrypts and decrypts messages from 8 bytes to
+ * 64 MiB with both key sizes, and the results are printed to the standard
+ * output as a JSON document, so that the results of two releases could be
+ * compared by a script.
+ *
+ * The agility mode measures the cost of a key change instead: the latency
+ * of the key setup, the latency of the first block after a key change, and
+ * the latency of a block with the one-shot functions. The one-shot
+ * functions only take the default key size, so their fields are null for
+ * the other key size.
+ *
+ * The NUMA mode measures the worker pool on a buffer of the largest size,
+ * first with the pages placed in a slice per node, and then with the pages
+ * interleaved over the nodes. The buffer is taken from huge pages when the
+ * host has them.
+ *
+ * Every measurement is repeated several times. The median of the runs is
+ * reported together with the spread between the fastest and the slowest
+ * run. Cycles are read from the time stamp counter on x86 targets; on the
+ * other targets, the cycle fields are null.
+ *
+ * Usage: bench.out [-m throughput|agility|numa] [-r runs] [-s max_size]
+ *                  [-e engine]
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+
+/*
+ * Required for the monotonic clock of POSIX.
+ */
+#define _POSIX_C_SOURCE 199309L
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <cpu.h>
+#include <present.h>
+#include <present_numa.h>
+#include <present_pool.h>
+
+#if CPU_USE_X86
+#   include <x86intrin.h>
+#endif  /* CPU_USE_X86 */
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Smallest message size of the benchmark in bytes.
+ */
+#define BENCH_SIZE_MIN     (8u)
+
+/*
+ * Largest message size of the benchmark in bytes.
+ */
+#define BENCH_SIZE_MAX     (64ul * 1024ul * 1024ul)
+
+/*
+ * Growth factor of the message size between two measurements.
+ */
+#define BENCH_SIZE_FACTOR  (8u)
+
+/*
+ * Default count of the runs of a measurement.
+ */
+#define BENCH_RUN_COUNT    (5u)
+
+/*
+ * Maximum count of the runs of a measurement.
+ */
+#define BENCH_RUN_MAX      (64u)
+
+/*
+ * Minimum byte count that a run processes. Small messages are crypted
+ * repeatedly until the count is reached, so that the timer resolution does
+ * not dominate the result.
+ */
+#define BENCH_RUN_BYTES    (1024ul * 1024ul)
+
+/*
+ * Count of the operations that a run of the agility mode times.
+ */
+#define BENCH_AGILITY_REPEAT (4096ul)
+
+/*
+ * Count of the key sizes.
+ */
+#define BENCH_KEY_SIZE_COUNT (2u)
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief Crypt function type of the benchmark.
+ */
+typedef void (*bench_crypt_fn_t)(present_ctx_t const * p_ctx, \
+                                 uint8_t * p_dst, uint8_t const * p_src, \
+                                 size_t count);
+
+/**
+ * @brief Operation type of the agility mode.
+ */
+typedef enum {
+    /*! Key setup of a new key. */
+    BENCH_OP_KEY_SETUP,
+    /*! Key setup of a new key and encryption of the first block. */
+    BENCH_OP_FIRST_ENCRYPT,
+    /*! Key setup of a new key and decryption of the first block. */
+    BENCH_OP_FIRST_DECRYPT,
+    /*! Encryption of a block with the expanded key context. */
+    BENCH_OP_CTX_ENCRYPT,
+    /*! Encryption of a block with the one-shot function. */
+    BENCH_OP_ONESHOT_ENCRYPT,
+    /*! Decryption of a block with the one-shot function. */
+    BENCH_OP_ONESHOT_DECRYPT,
+    /*! Count of the operations. */
+    BENCH_OP_COUNT
+} bench_op_t;
+
+/**
+ * @brief Result type of a single run.
+ */
+typedef struct {
+    /*! Elapsed time in nanoseconds. */
+    double ns;
+    /*! Elapsed time stamp counter cycles. */
+    double cycles;
+} bench_run_t;
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Reads the monotonic clock.
+ *
+ * @return The time in nanoseconds.
+ */
+static double
+bench_now_ns(void);
+
+/**
+ * @brief Reads the cycle counter.
+ *
+ * @return The cycle count, or zero if the target has no cycle counter.
+ */
+static double
+bench_now_cycles(void);
+
+/**
+ * @brief Compares two doubles for the sorting.
+ *
+ * @param[in] p_a Pointer of the first value.
+ * @param[in] p_b Pointer of the second value.
+ *
+ * @return Negative, zero or positive as the first value is less than,
+ *         equal to or greater than the second one.
+ */
+static int
+bench_compare(void const * p_a, void const * p_b);
+
+/**
+ * @brief Measures a crypt function and prints the result.
+ *
+ * The function runs \a crypt on \a size bytes of \a p_buf \a runs times
+ * and prints the median, the spread and the throughput of the runs as a
+ * JSON object.
+ *
+ * @param[in] p_ctx    Pointer of the crypt context.
+ * @param[in] key_size Size of the key of the context in byte.
+ * @param[in] p_op     Name of the operation.
+ * @param[in] crypt    The crypt function.
+ * @param[in] p_buf    Pointer of the message buffer.
+ * @param[in] size     Size of the message in bytes.
+ * @param[in] runs     Count of the runs.
+ * @param[in] p_sep    Separator that is printed before the object.
+ *
+ * @return None.
+ */
+static void
+bench_measure(present_ctx_t const * p_ctx, size_t key_size, \
+              char const * p_op, \
+              bench_crypt_fn_t crypt, uint8_t * p_buf, size_t size, \
+              unsigned int runs, char const * p_sep);
+
+/**
+ * @brief Measures the latency of an agility operation.
+ *
+ * The function runs the operation given by \a op \a runs times and stores
+ * the median latency of a single operation to \a p_result. The one-shot
+ * operations must only be run with the default key size.
+ *
+ * @param[in]  op       The operation.
+ * @param[in]  key_size Size of the key in byte.
+ * @param[in]  runs     Count of the runs.
+ * @param[out] p_result Pointer of the median latency.
+ *
+ * @return None.
+ */
+static void
+bench_latency(bench_op_t op, size_t key_size, unsigned int runs, \
+              bench_run_t * p_result);
+
+/**
+ * @brief Measures the key agility of the active engine and prints it.
+ *
+ * The function measures all the agility operations and prints them as a
+ * JSON object. The one-shot operations are printed as null if the key size
+ * is not the default one.
+ *
+ * @param[in] key_size Size of the key in byte.
+ * @param[in] runs     Count of the runs.
+ * @param[in] p_sep    Separator that is printed before the object.
+ *
+ * @return None.
+ */
+static void
+bench_agility(size_t key_size, unsigned int runs, char const * p_sep);
+
+/**
+ * @brief Measures the worker pool on the NUMA placements and prints them.
+ *
+ * The function encrypts \a size bytes by a pool of all the online CPUs,
+ * once with the pages in a slice per node and once with the pages
+ * interleaved, and prints both as JSON objects.
+ *
+ * @param[in] size  Size of the message in bytes.
+ * @param[in] runs  Count of the runs.
+ * @param[in] p_sep Separator that is printed before the first object.
+ *
+ * @return False if the buffer or the pool could not be allocated.
+ */
+static bool
+bench_numa(size_t size, unsigned int runs, char const * p_sep);
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static double
+bench_now_ns (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double)now.tv_sec * 1e9 + (double)now.tv_nsec;
+}  /* bench_now_ns() */
+
+static double
+bench_now_cycles (void)
+{
+#if CPU_USE_X86
+    return (double)__rdtsc();
+#else
+    return 0.0;
+#endif  /* CPU_USE_X86 */
+}  /* bench_now_cycles() */
+
+static int
+bench_compare (void const * p_a, void const * p_b)
+{
+    double a = *(double const *)p_a;
+    double b = *(double const *)p_b;
+
+    return (a > b) - (a < b);
+}  /* bench_compare() */
+
+static void
+bench_measure (present_ctx_t const * p_ctx, size_t key_size, \
+               char const * p_op, \
+               bench_crypt_fn_t crypt, uint8_t * p_buf, size_t size, \
+               unsigned int runs, char const * p_sep)
+{
+    double        rate[BENCH_RUN_MAX];
+    double        cpb[BENCH_RUN_MAX];
+    bench_run_t   start;
+    size_t        blocks = size / PRESENT_CRYPT_SIZE;
+    unsigned long repeat;
+    unsigned long iter;
+    unsigned int  run;
+
+    /*
+     * Crypt small messages repeatedly to keep every run long enough.
+     */
+    repeat = (size < BENCH_RUN_BYTES) ? (BENCH_RUN_BYTES / size) : 1ul;
+
+    /*
+     * Warm up the caches and the engine selection.
+     */
+    crypt(p_ctx, p_buf, p_buf, blocks);
+
+    for (run = 0u; run < runs; run++)
+    {
+        start.ns     = bench_now_ns();
+        start.cycles = bench_now_cycles();
+
+        for (iter = 0u; iter < repeat; iter++)
+        {
+            crypt(p_ctx, p_buf, p_buf, blocks);
+        }
+
+        cpb[run]  = (bench_now_cycles() - start.cycles) \
+                    / ((double)size * (double)repeat);
+        rate[run] = (double)blocks * (double)repeat * 1e9 \
+                    / (bench_now_ns() - start.ns);
+    }
+
+    qsort(rate, runs, sizeof(rate[0]), bench_compare);
+    qsort(cpb, runs, sizeof(cpb[0]), bench_compare);
+
+    printf("%s    {\"engine\": \"%s\", \"op\": \"%s\", \"key_bits\": %u, "
+           "\"bytes\": %lu, ", p_sep,
+           present_get_engine_name(present_get_engine()), p_op,
+           (unsigned int)(key_size * 8u), (unsigned long)size);
+
+    if (CPU_USE_X86)
+    {
+        printf("\"cycles_per_byte\": %.3f, ", cpb[runs / 2u]);
+    }
+    else
+    {
+        printf("\"cycles_per_byte\": null, ");
+    }
+
+    /*
+     * The spread is the distance between the slowest and the fastest run
+     * relative to the median.
+     */
+    printf("\"blocks_per_s\": %.0f, \"spread_pct\": %.2f}",
+           rate[runs / 2u],
+           100.0 * (rate[runs - 1u] - rate[0]) / rate[runs / 2u]);
+}  /* bench_measure() */
+
+static void
+bench_latency (bench_op_t op, size_t key_size, unsigned int runs, \
+               bench_run_t * p_result)
+{
+    double        ns[BENCH_RUN_MAX];
+    double        cycles[BENCH_RUN_MAX];
+    bench_run_t   start;
+    present_ctx_t ctx;
+    uint8_t       key[PRESENT_KEY128_SIZE];
+    uint8_t       text[PRESENT_CRYPT_SIZE];
+    unsigned long iter;
+    unsigned int  run;
+
+    memset(key, 0x5A, sizeof(key));
+    memset(text, 0xA5, sizeof(text));
+
+    (void)present_key_setup(&ctx, key, key_size);
+
+    for (run = 0u; run < runs; run++)
+    {
+        start.ns     = bench_now_ns();
+        start.cycles = bench_now_cycles();
+
+        for (iter = 0u; iter < BENCH_AGILITY_REPEAT; iter++)
+        {
+            /*
+             * Change the key at every operation, as the workload does.
+             */
+            key[iter % key_size]++;
+
+            switch (op)
+            {
+                case BENCH_OP_KEY_SETUP:
+                    (void)present_key_setup(&ctx, key, key_size);
+                    break;
+
+                case BENCH_OP_FIRST_ENCRYPT:
+                    (void)present_key_setup(&ctx, key, key_size);
+                    present_ctx_encrypt(&ctx, text);
+                    break;
+
+                case BENCH_OP_FIRST_DECRYPT:
+                    (void)present_key_setup(&ctx, key, key_size);
+                    present_ctx_decrypt(&ctx, text);
+                    break;
+
+                case BENCH_OP_CTX_ENCRYPT:
+                    present_ctx_encrypt(&ctx, text);
+                    break;
+
+                case BENCH_OP_ONESHOT_ENCRYPT:
+                    present_encrypt(text, key);
+                    break;
+
+                default:
+                    present_decrypt(text, key);
+                    break;
+            }
+        }
+
+        cycles[run] = (bench_now_cycles() - start.cycles) \
+                      / (double)BENCH_AGILITY_REPEAT;
+        ns[run]     = (bench_now_ns() - start.ns) \
+                      / (double)BENCH_AGILITY_REPEAT;
+    }
+
+    qsort(ns, runs, sizeof(ns[0]), bench_compare);
+    qsort(cycles, runs, sizeof(cycles[0]), bench_compare);
+
+    p_result->ns     = ns[runs / 2u];
+    p_result->cycles = cycles[runs / 2u];
+}  /* bench_latency() */
+
+static void
+bench_agility (size_t key_size, unsigned int runs, char const * p_sep)
+{
+    static char const * const op_names[BENCH_OP_COUNT] = {
+        "key_setup",
+        "first_encrypt",
+        "first_decrypt",
+        "ctx_encrypt",
+        "oneshot_encrypt",
+        "oneshot_decrypt"
+    };
+
+    bench_run_t latency[BENCH_OP_COUNT];
+    uint8_t     ops = BENCH_OP_COUNT;
+    uint8_t     op;
+
+    /*
+     * The one-shot operations are the last ones. They could not take the
+     * other key size, and the same steps on a context would only repeat
+     * the first block latencies.
+     */
+    if (PRESENT_KEY_SIZE != key_size)
+    {
+        ops = BENCH_OP_ONESHOT_ENCRYPT;
+    }
+
+    for (op = 0u; op < ops; op++)
+    {
+        bench_latency((bench_op_t)op, key_size, runs, &latency[op]);
+    }
+
+    printf("%s    {\"engine\": \"%s\", \"key_bits\": %u", p_sep,
+           present_get_engine_name(present_get_engine()),
+           (unsigned int)(key_size * 8u));
+
+    for (op = 0u; op < BENCH_OP_COUNT; op++)
+    {
+        if (op >= ops)
+        {
+            printf(", \"%s_ns\": null, \"%s_cycles\": null", op_names[op],
+                   op_names[op]);
+            continue;
+        }
+
+        printf(", \"%s_ns\": %.1f", op_names[op], latency[op].ns);
+
+        if (CPU_USE_X86)
+        {
+            printf(", \"%s_cycles\": %.0f", op_names[op], latency[op].cycles);
+        }
+        else
+        {
+            printf(", \"%s_cycles\": null", op_names[op]);
+        }
+    }
+
+    printf("}");
+}  /* bench_agility() */
+
+static bool
+bench_numa (size_t size, unsigned int runs, char const * p_sep)
+{
+    static char const * const placements[] = {"local", "interleaved"};
+
+    double         rate[BENCH_RUN_MAX];
+    double         start;
+    present_numa_t numa;
+    present_pool_t pool;
+    present_ctx_t  ctx;
+    uint8_t        key[PRESENT_KEY_SIZE];
+    uint8_t *      p_buf;
+    size_t         blocks = size / PRESENT_CRYPT_SIZE;
+    bool           huge;
+    bool           placed;
+    unsigned int   placement;
+    unsigned int   run;
+
+    p_buf = present_numa_alloc(size, &huge);
+
+    if (NULL == p_buf)
+    {
+        return false;
+    }
+
+    if (!present_pool_init(&pool, 0u, 0u, true))
+    {
+        present_numa_free(p_buf, size);
+        return false;
+    }
+
+    /*
+     * Touch the pages before they are moved.
+     */
+    memset(p_buf, 0xA5, size);
+    memset(key, 0x5A, sizeof(key));
+
+    (void)present_numa_init(&numa);
+    (void)present_key_setup(&ctx, key, sizeof(key));
+
+    for (placement = 0u; placement < 2u; placement++)
+    {
+        placed = present_numa_place(&numa, p_buf, size, 1u == placement);
+
+        /*
+         * Warm up the workers and the page tables.
+         */
+        present_pool_encrypt_blocks(&pool, &ctx, p_buf, p_buf, blocks);
+
+        for (run = 0u; run < runs; run++)
+        {
+            start = bench_now_ns();
+
+            present_pool_encrypt_blocks(&pool, &ctx, p_buf, p_buf, blocks);
+
+            rate[run] = (double)size * 1e9 / (bench_now_ns() - start);
+        }
+
+        qsort(rate, runs, sizeof(rate[0]), bench_compare);
+
+        printf("%s    {\"engine\": \"%s\", \"placement\": \"%s\", "
+               "\"nodes\": %lu, \"placed\": %s, \"huge_pages\": %s, "
+               "\"bytes\": %lu, \"bytes_per_s\": %.0f, "
+               "\"spread_pct\": %.2f}", p_sep,
+               present_get_engine_name(present_get_engine()),
+               placements[placement], (unsigned long)numa.node_count,
+               placed ? "true" : "false", huge ? "true" : "false",
+               (unsigned long)size, rate[runs / 2u],
+               100.0 * (rate[runs - 1u] - rate[0]) / rate[runs / 2u]);
+
+        p_sep = ",\n";
+    }
+
+    present_pool_destroy(&pool);
+    present_numa_free(p_buf, size);
+
+    return true;
+}  /* bench_numa() */
+
+/*****************************************************************************/
+/* MAIN FUNCTION                                                             */
+/*****************************************************************************/
+
+/**
+ * @brief Benchmark function of the project.
+ *
+ * The function parses the options, runs the benchmark of every selected
+ * engine and prints the results.
+ *
+ * @param[in] argc Count of the arguments.
+ * @param[in] argv The arguments.
+ *
+ * @return System error code.
+ */
+int main(int argc, char * argv[])
+{
+    static size_t const key_sizes[BENCH_KEY_SIZE_COUNT] = {
+        PRESENT_KEY80_SIZE,
+        PRESENT_KEY128_SIZE
+    };
+
+    present_ctx_t       ctx;
+    present_engine_id_t engine;
+    char const *        p_engine = NULL;
+    char const *        p_mode   = "throughput";
+    char const *        p_sep    = "";
+    uint8_t             key[PRESENT_KEY128_SIZE];
+    uint8_t *           p_buf;
+    uint8_t             key_size;
+    unsigned long       max_size = BENCH_SIZE_MAX;
+    unsigned long       size;
+    unsigned int        runs     = BENCH_RUN_COUNT;
+    int                 arg;
+
+    for (arg = 1; arg < argc - 1; arg += 2)
+    {
+        if (0 == strcmp(argv[arg], "-r"))
+        {
+            runs = (unsigned int)strtoul(argv[arg + 1], NULL, 0);
+        }
+        else if (0 == strcmp(argv[arg], "-s"))
+        {
+            max_size = strtoul(argv[arg + 1], NULL, 0);
+        }
+        else if (0 == strcmp(argv[arg], "-e"))
+        {
+            p_engine = argv[arg + 1];
+        }
+        else if (0 == strcmp(argv[arg], "-m"))
+        {
+            p_mode = argv[arg + 1];
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if ((arg != argc) || (0u == runs) || (runs > BENCH_RUN_MAX)
+        || (max_size < BENCH_SIZE_MIN)
+        || ((0 != strcmp(p_mode, "throughput"))
+            && (0 != strcmp(p_mode, "agility"))
+            && (0 != strcmp(p_mode, "numa"))))
+    {
+        fprintf(stderr, "usage: %s [-m throughput|agility|numa] [-r runs] "
+                "[-s max_size] [-e engine]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    max_size -= max_size % PRESENT_CRYPT_SIZE;
+    p_buf     = malloc(max_size);
+
+    if (NULL == p_buf)
+    {
+        fprintf(stderr, "%s: out of memory\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    memset(p_buf, 0xA5, max_size);
+    memset(key, 0x5A, sizeof(key));
+
+    printf("{\n  \"mode\": \"%s\",\n  \"rounds\": %u,\n  \"runs\": %u,\n"
+           "  \"results\": [\n", p_mode, (unsigned int)PRESENT_ROUND_COUNT,
+           runs);
+
+    for (engine = PRESENT_ENGINE_REF; engine < PRESENT_ENGINE_COUNT; engine++)
+    {
+        /*
+         * Skip the engines that are filtered out or not supported by the
+         * host CPU.
+         */
+        if (((NULL != p_engine)
+             && ((NULL == present_get_engine_name(engine))
+                 || (0 != strcmp(p_engine, present_get_engine_name(engine)))))
+            || !present_set_engine(engine))
+        {
+            continue;
+        }
+
+        /*
+         * The placements are compared on the default key only.
+         */
+        if (0 == strcmp(p_mode, "numa"))
+        {
+            if (!bench_numa(max_size, runs, p_sep))
+            {
+                fprintf(stderr, "%s: out of memory\n", argv[0]);
+                free(p_buf);
+                return EXIT_FAILURE;
+            }
+
+            p_sep = ",\n";
+            continue;
+        }
+
+        for (key_size = 0u; key_size < BENCH_KEY_SIZE_COUNT; key_size++)
+        {
+            if (0 == strcmp(p_mode, "agility"))
+            {
+                bench_agility(key_sizes[key_size], runs, p_sep);
+                p_sep = ",\n";
+                continue;
+            }
+
+            (void)present_key_setup(&ctx, key, key_sizes[key_size]);
+
+            for (size = BENCH_SIZE_MIN; size <= max_size;
+                 size = ((size * BENCH_SIZE_FACTOR > max_size)
+                         && (size < max_size))
+                        ? max_size : size * BENCH_SIZE_FACTOR)
+            {
+                bench_measure(&ctx, key_sizes[key_size], "encrypt",
+                              present_encrypt_blocks, p_buf, size, runs,
+                              p_sep);
+                p_sep = ",\n";
+
+                bench_measure(&ctx, key_sizes[key_size], "decrypt",
+                              present_decrypt_blocks, p_buf, size, runs,
+                              p_sep);
+            }
+        }
+    }
+
+    printf("\n  ]\n}\n");
+
+    free(p_buf);
+
+    return EXIT_SUCCESS;
+}  /* main() */
+
+/*** END OF FILE ***/
@@ -47,4 +47,4 @@ LIB_PATH =
 # The tag describes the library files to be included to the project. Multiple
 # libraries could be added.
 
-LIB      =
+LIB      = pthread
@@ -14,6 +14,11 @@ else ifeq (${STD}, C11)
 	CC_FLAGS += -std=c11
 endif
 
+# Add optimization level flag.
+ifneq (${OPT},)
+	CC_FLAGS += -${OPT}
+endif
+
 # Add strict ISO C warnings flag.
 ifeq (${STRICT_ISO}, YES)
 	CC_FLAGS += -pedantic
@@ -29,18 +34,32 @@ ifeq (${WARN_EXTRA}, YES)
 	CC_FLAGS += -Wextra
 endif
 
+#------------------------------------------------------------------------------
+# LINKER FLAGS
+#------------------------------------------------------------------------------
+
+# Add search path for library files.
+CL_LIBS += $(addprefix -L , ${LIB_PATH})
+
+# Add library files. They follow the objects, so that the linker resolves
+# the symbols of the objects from them.
+CL_LIBS += $(addprefix -l, ${LIB})
+
 #------------------------------------------------------------------------------
 # BUILD RULES
 #------------------------------------------------------------------------------
 
 ${EXEC}:
-	${CL} ${CL_FLAGS} -o $@ ${OBJ}
+	${CL} ${CL_FLAGS} -o $@ ${OBJ} ${CL_LIBS}
 
 ${SLIB}:
 	${AR} -crv $@ ${OBJ}
 
+${BENCH_OUT}: ${BENCH_OBJ}
+	${CL} ${CL_FLAGS} -o $@ ${BENCH_OBJ} ${CL_LIBS}
+
 ${TEST_OUT}: ${TEST_DEPS}
-	${CL} ${CL_FLAGS} -o $@ ${OBJ} ${TEST_OBJ}
+	${CL} ${CL_FLAGS} -o $@ ${OBJ} ${TEST_OBJ} ${CL_LIBS}
 
 ${BIN_PATH}/%.o: ${PROJ_PATH}/%.c
 	@${MKDIR} "$(dir $@)" ||:
@@ -25,6 +25,17 @@ STD = C99
 
 STRICT_ISO = YES
 
+# The tag describes the optimization level. If the tag left blank, compiler's
+# default level is used. For GCC, default level is O0.
+# Supported levels:
+# O0 -> No optimization
+# O1 -> Basic optimizations
+# O2 -> Optimizations without space-speed tradeoff
+# O3 -> Aggressive optimizations including loop unrolling and vectorization
+# Os -> Optimizations for size
+
+OPT = O2
+
 # The tag specifies all warning flag feature. If the tag set as 'YES',
 # all warning flags are enabled while compiling.
 
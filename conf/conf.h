@@ -36,19 +36,199 @@
 #define CONF_PRESENT (1u)
 #if CONF_PRESENT
     /*
-     * PRESENT key size flag. To use 80-bit key, enable this flag.
+     * PRESENT default key size flag. To use 80-bit key by default, enable
+     * this flag. Both key sizes could be used through the key setup
+     * function regardless of the default.
      */
 #   define PRESENT_USE_KEY80  (1u)
 
     /*
-     * PRESENT key size flag. To use 128-bit key, enable this flag.
+     * PRESENT default key size flag. To use 128-bit key by default, enable
+     * this flag.
      */
 #   define PRESENT_USE_KEY128 (0u)
 
     /*
-     * PRESENT algorithm round count.
+     * PRESENT algorithm default round count. The crypt engines have kernels
+     * that are specialized for this round count. Other round counts could
+     * be set per context at runtime.
      */
 #   define PRESENT_ROUND_COUNT (31u)
 #endif  /* CONF_PRESENT */
 
+/*
+ * PRESENT key cache module configuration flag.
+ */
+#define CONF_PRESENT_CACHE (1u)
+#if CONF_PRESENT_CACHE
+    /*
+     * Slot count of a cache set. A key could only be stored in the slots of
+     * the set that its hash selects. Larger sets cause fewer conflict
+     * evictions but longer lookups.
+     */
+#   define PRESENT_CACHE_WAYS (4u)
+    /*
+     * Count of the hit and miss counters of a cache. Every thread counts on
+     * one of them, so that the hits of a hot key from many threads do not
+     * write the same line. It should not be less than the count of the CPUs.
+     */
+#   define PRESENT_CACHE_STRIPES (16u)
+    /*
+     * Size of a CPU cache line in byte. The fields of a cache that are
+     * written by the lookups are kept off the lines of the read-only ones.
+     */
+#   define PRESENT_CACHE_LINE (64u)
+#endif  /* CONF_PRESENT_CACHE */
+
+/*
+ * PRESENT counter mode module configuration flag.
+ */
+#define CONF_PRESENT_CTR (1u)
+#if CONF_PRESENT_CTR
+    /*
+     * Count of the keystream blocks that are generated per engine call. It
+     * should be a multiple of the parallel block count of the fastest
+     * engine. The keystream buffer is allocated on the stack.
+     */
+#   define PRESENT_CTR_BATCH (128u)
+#endif  /* CONF_PRESENT_CTR */
+
+/*
+ * PRESENT cipher block chaining mode module configuration flag.
+ */
+#define CONF_PRESENT_CBC (1u)
+#if CONF_PRESENT_CBC
+    /*
+     * Count of the blocks that are decrypted per engine call. The
+     * decryption buffer is allocated on the stack.
+     */
+#   define PRESENT_CBC_BATCH (128u)
+#endif  /* CONF_PRESENT_CBC */
+
+/*
+ * PRESENT multi-buffer manager module configuration flag.
+ */
+#define CONF_PRESENT_MB (1u)
+#if CONF_PRESENT_MB
+    /*
+     * Count of the jobs that a manager advances in lockstep. It should be
+     * a multiple of the parallel block count of the fastest engine.
+     */
+#   define PRESENT_MB_LANES (64u)
+#endif  /* CONF_PRESENT_MB */
+
+/*
+ * PRESENT streaming module configuration flag.
+ */
+#define CONF_PRESENT_STREAM (1u)
+
+/*
+ * PRESENT scatter-gather module configuration flag. The module uses the
+ * POSIX iovec structure, so disable it on the hosts without <sys/uio.h>.
+ */
+#define CONF_PRESENT_IOV (1u)
+
+/*
+ * PRESENT NUMA module configuration flag. The topology is read from the
+ * sysfs of Linux. On the other hosts, the module reports a single node.
+ */
+#define CONF_PRESENT_NUMA (1u)
+#if CONF_PRESENT_NUMA
+    /*
+     * Maximum count of the NUMA nodes.
+     */
+#   define PRESENT_NUMA_NODES_MAX (64u)
+
+    /*
+     * Maximum count of the CPUs. The CPUs above the limit are reported on
+     * the first node.
+     */
+#   define PRESENT_NUMA_CPUS_MAX (1024u)
+
+    /*
+     * Size of the huge pages in byte.
+     */
+#   define PRESENT_NUMA_HUGE_PAGE (2097152ul)
+#endif  /* CONF_PRESENT_NUMA */
+
+/*
+ * PRESENT worker pool module configuration flag. The module uses the POSIX
+ * threads, so disable it on the hosts without <pthread.h>.
+ */
+#define CONF_PRESENT_POOL (1u)
+#if CONF_PRESENT_POOL
+    /*
+     * Maximum count of the worker threads of a pool.
+     */
+#   define PRESENT_POOL_THREADS_MAX (128u)
+
+    /*
+     * Size of the chunks that the workers take in byte. It must be a
+     * multiple of the block size. A chunk should fit into the private
+     * caches of a core together with its output.
+     */
+#   define PRESENT_POOL_CHUNK (32768u)
+
+    /*
+     * Count of the chunks that are sorted by their NUMA node at once. A
+     * larger call runs in several rounds of this many chunks.
+     */
+#   define PRESENT_POOL_ROUND (1024u)
+#endif  /* CONF_PRESENT_POOL */
+
+/*
+ * PRESENT work-stealing scheduler module configuration flag. The module
+ * uses the POSIX threads, so disable it on the hosts without <pthread.h>.
+ */
+#define CONF_PRESENT_SCHED (1u)
+#if CONF_PRESENT_SCHED
+    /*
+     * Maximum count of the workers of a scheduler.
+     */
+#   define PRESENT_SCHED_THREADS_MAX (128u)
+
+    /*
+     * Capacity of the job deque of a worker. A batch is rejected from the
+     * first job that finds all the deques full.
+     */
+#   define PRESENT_SCHED_DEQUE (1024u)
+
+    /*
+     * Maximum count of the jobs that a submission pushes into a deque under
+     * one hold of its lock.
+     */
+#   define PRESENT_SCHED_BATCH (8u)
+#endif  /* CONF_PRESENT_SCHED */
+
+/*
+ * PRESENT asynchronous queue module configuration flag. The module uses the
+ * POSIX threads and the job body of the scheduler module.
+ */
+#define CONF_PRESENT_ASYNC (1u)
+#if CONF_PRESENT_ASYNC
+    /*
+     * Maximum count of the workers of a queue.
+     */
+#   define PRESENT_ASYNC_THREADS_MAX (64u)
+
+    /*
+     * Entry count of the submission and the completion rings. It must be a
+     * power of two. It also limits the count of the jobs in flight, so the
+     * completion ring never overflows.
+     */
+#   define PRESENT_ASYNC_ENTRIES (256u)
+
+    /*
+     * Size of the chunks of the bulk jobs in byte. It must be a multiple of
+     * the block size. It bounds the wait of a high priority job.
+     */
+#   define PRESENT_ASYNC_CHUNK (4096u)
+
+    /*
+     * Bucket count of the latency histograms. The last bucket starts at
+     * 2^(count - 1) nanoseconds.
+     */
+#   define PRESENT_ASYNC_HIST_BUCKETS (40u)
+#endif  /* CONF_PRESENT_ASYNC */
+
 #endif  /* CONF_H */
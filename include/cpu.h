@@ -0,0 +1,114 @@
+/**
+ * @file cpu.h
+ * @brief Header file of the CPU feature module.
+ *
+ * The file is the C/C++ interface of the CPU feature module. The file
+ * contains global symbol and function declarations, data structures, type
+ * definitions, etc, of the module.
+ *
+ * The module detects the instruction set extensions of the host CPU, so
+ * that the optimized code is only run on the CPUs that support it.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef CPU_H
+#define CPU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <macros.h>
+
+/*****************************************************************************/
+/* GLOBAL SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * x86 feature detection flag. The feature detection is only supported by
+ * GCC compatible compilers on x86 targets.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#   define CPU_USE_X86 (1u)
+#else
+#   define CPU_USE_X86 (0u)
+#endif
+
+/*
+ * Feature flag of the SSSE3 instruction set.
+ */
+#define CPU_FEATURE_SSSE3 (BIT(0u))
+
+/*
+ * Feature flag of the AVX2 instruction set. The flag is only set if the
+ * operating system saves the AVX registers as well.
+ */
+#define CPU_FEATURE_AVX2  (BIT(1u))
+
+/*
+ * Count of the calls of a spin wait that pause the CPU before the calls
+ * start to yield it.
+ */
+#define CPU_SPIN_PAUSES   (64u)
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Gets the features of the host CPU.
+ *
+ * The function returns the supported features of the host CPU as a
+ * combination of the CPU_FEATURE flags. The CPU is only queried by the
+ * first call and the result is reused afterwards. On the unsupported
+ * targets, the function returns zero.
+ *
+ * @return The feature flags.
+ */
+unsigned int
+cpu_get_features(void);
+
+/**
+ * @brief Waits a moment in a spin loop.
+ *
+ * The function is called at every turn of a loop that waits for a lock.
+ * The first @ref CPU_SPIN_PAUSES calls of a wait pause the CPU, so that the
+ * spinning thread leaves the core to its sibling. The later calls yield the
+ * CPU, so that a lock holder that was preempted could run.
+ *
+ * @param[in,out] p_spins Pointer of the count of the calls of the wait. It
+ *                        must be zero before the first call.
+ *
+ * @return None.
+ */
+void
+cpu_spin(unsigned int * p_spins);
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* CPU_H */
+
+/*** END OF FILE ***/
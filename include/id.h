@@ -38,9 +38,39 @@ extern "C" {
  */
 typedef enum {
     /*! ID of the \ref main.c */
-    FILE_ID_MAIN    = 1u,
+    FILE_ID_MAIN             = 1u,
     /*! ID of the \ref present.c */
-    FILE_ID_PRESENT = 2u
+    FILE_ID_PRESENT          = 2u,
+    /*! ID of the \ref present_word.c */
+    FILE_ID_PRESENT_WORD     = 3u,
+    /*! ID of the \ref present_table.c */
+    FILE_ID_PRESENT_TABLE    = 4u,
+    /*! ID of the \ref present_bitslice.c */
+    FILE_ID_PRESENT_BITSLICE = 5u,
+    /*! ID of the \ref present_simd.c */
+    FILE_ID_PRESENT_SIMD     = 6u,
+    /*! ID of the \ref cpu.c */
+    FILE_ID_CPU              = 7u,
+    /*! ID of the \ref present_cache.c */
+    FILE_ID_PRESENT_CACHE    = 8u,
+    /*! ID of the \ref present_ctr.c */
+    FILE_ID_PRESENT_CTR      = 9u,
+    /*! ID of the \ref present_cbc.c */
+    FILE_ID_PRESENT_CBC      = 10u,
+    /*! ID of the \ref present_mb.c */
+    FILE_ID_PRESENT_MB       = 11u,
+    /*! ID of the \ref present_stream.c */
+    FILE_ID_PRESENT_STREAM   = 12u,
+    /*! ID of the \ref present_iov.c */
+    FILE_ID_PRESENT_IOV      = 13u,
+    /*! ID of the \ref present_pool.c */
+    FILE_ID_PRESENT_POOL     = 14u,
+    /*! ID of the \ref present_sched.c */
+    FILE_ID_PRESENT_SCHED    = 15u,
+    /*! ID of the \ref present_async.c */
+    FILE_ID_PRESENT_ASYNC    = 16u,
+    /*! ID of the \ref present_numa.c */
+    FILE_ID_PRESENT_NUMA     = 17u
 } file_id_t;
 
 #ifdef __cplusplus
@@ -86,6 +86,18 @@ extern "C" {
  */
 #define UNUSED_PARAM(x) ((void)x)
 
+/**
+ * @brief Gets the element count of an array.
+ *
+ * The macro divides the size of the array \a x by the size of its first
+ * element. It must not be used with pointers.
+ *
+ * @param[in] x The array.
+ *
+ * @return The element count.
+ */
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+
 #ifdef __cplusplus
 }
 #endif  /* __cplusplus */
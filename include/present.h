@@ -66,7 +66,18 @@ extern "C" {
 #define PRESENT_CRYPT_SIZE (PRESENT_CRYPT_BIT_SIZE / 8u)
 
 /*
- * PRESENT key block size in bit.
+ * PRESENT 80-bit key block size in byte.
+ */
+#define PRESENT_KEY80_SIZE  (10u)
+
+/*
+ * PRESENT 128-bit key block size in byte.
+ */
+#define PRESENT_KEY128_SIZE (16u)
+
+/*
+ * PRESENT default key block size in bit. The default key size is used by
+ * the functions that do not take the key size as a parameter.
  */
 #if PRESENT_USE_KEY80
 #   define PRESENT_KEY_BIT_SIZE (80u)
@@ -75,7 +86,7 @@ extern "C" {
 #endif  /* PRESENT_USE_KEY128 */
 
 /*
- * PRESENT key block size in byte.
+ * PRESENT default key block size in byte.
  */
 #define PRESENT_KEY_SIZE (PRESENT_KEY_BIT_SIZE / 8u)
 
@@ -89,10 +100,360 @@ extern "C" {
  */
 #define PRESENT_ROUND_COUNT_MAX (31u)
 
+/*
+ * Name of the environment variable that overrides the automatic engine
+ * selection. Its value is an engine name, such as "table" or "avx2".
+ */
+#define PRESENT_ENGINE_ENV "PRESENT_ENGINE"
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT crypt context type.
+ *
+ * This type holds the expanded key schedule of a crypt key. The schedule is
+ * generated once by @ref present_key_setup and only read by the crypt
+ * functions, so that a long-lived key does not pay for the key scheduling
+ * at every block.
+ *
+ * The schedule is always expanded for the maximum round count, so the
+ * round count of the context could be changed without a new key setup.
+ */
+typedef struct {
+    /*! Round keys that are added to the text block at every round. Bit i
+        of a round key is added to the bit i of the text block. */
+    uint64_t round_key[PRESENT_ROUND_COUNT_MAX + 1u];
+    /*! Round keys moved by the inverse permutation layer. They are used by
+        the engines that merge the layers of the decryption. */
+    uint64_t inv_round_key[PRESENT_ROUND_COUNT_MAX + 1u];
+    /*! Round count of the crypt functions. */
+    uint8_t  rounds;
+} present_ctx_t;
+
+/**
+ * @brief PRESENT crypt engine ID type.
+ *
+ * This type is used to select the implementation of the crypt functions.
+ * All engines produce the same result.
+ */
+typedef enum {
+    /*! Reference engine which processes the text block byte by byte. */
+    PRESENT_ENGINE_REF,
+    /*! Engine which keeps the text block in a 64-bit word. */
+    PRESENT_ENGINE_WORD,
+    /*! Engine which merges the substitution and the permutation layers into
+        lookup tables. */
+    PRESENT_ENGINE_TABLE,
+    /*! Engine which processes 64 blocks in parallel in the bitsliced
+        layout. */
+    PRESENT_ENGINE_BITSLICE,
+    /*! Engine which processes two blocks per SSSE3 register. */
+    PRESENT_ENGINE_SSSE3,
+    /*! Engine which processes four blocks per AVX2 register. */
+    PRESENT_ENGINE_AVX2,
+    /*! Count of the engines. */
+    PRESENT_ENGINE_COUNT
+} present_engine_id_t;
+
 /*****************************************************************************/
 /* GLOBAL FUNCTION PROTOTYPES                                                */
 /*****************************************************************************/
 
+/**
+ * @brief Selects the crypt engine.
+ *
+ * The function binds the engine given by \a engine to the crypt functions
+ * of the module. The selection affects all the contexts. Engines that
+ * require CPU features are only selected if the host CPU supports them.
+ *
+ * @param[in] engine The engine ID.
+ *
+ * @return True if the engine is selected, false otherwise.
+ */
+bool
+present_set_engine(present_engine_id_t engine);
+
+/**
+ * @brief Selects the crypt engine automatically.
+ *
+ * The function binds the fastest engine that the host CPU supports to the
+ * crypt functions of the module. If the environment variable
+ * @ref PRESENT_ENGINE_ENV names a supported engine, that engine is bound
+ * instead. The crypt functions call this function once by themselves if no
+ * engine was selected before, so it is only needed to undo a
+ * @ref present_set_engine call. With the GCC atomic builtins, the first
+ * crypt calls of many threads could run at the same time.
+ *
+ * @return None.
+ */
+void
+present_reset_engine(void);
+
+/**
+ * @brief Gets the active crypt engine.
+ *
+ * The function returns the ID of the engine that is bound to the crypt
+ * functions of the module. If no engine was selected yet, the engine is
+ * selected automatically first.
+ *
+ * @return The engine ID.
+ */
+present_engine_id_t
+present_get_engine(void);
+
+/**
+ * @brief Gets the name of the crypt engine.
+ *
+ * The function returns the name of the engine given by \a engine. The name
+ * is the value that selects the engine through @ref PRESENT_ENGINE_ENV.
+ *
+ * @param[in] engine The engine ID.
+ *
+ * @return The engine name, or NULL if the engine does not exist in the
+ *         build.
+ */
+char const *
+present_get_engine_name(present_engine_id_t engine);
+
+/**
+ * @brief Expands the crypt key into the context.
+ *
+ * The function generates all the round keys of the crypt key pointed by
+ * \a p_key and stores them in the context pointed by \a p_ctx. The same
+ * context could be used for both encryption and decryption. Both key sizes
+ * are supported by every build, so contexts of different key sizes could
+ * be used together. The round count of the context is set to
+ * @ref PRESENT_ROUND_COUNT.
+ *
+ * @warning The function assumes parameter \a p_key points a memory block
+ *          with length of \a key_size.
+ *
+ * @param[out] p_ctx    Pointer of the crypt context.
+ * @param[in]  p_key    Pointer of the crypt key.
+ * @param[in]  key_size Size of the key in byte. Either
+ *                      @ref PRESENT_KEY80_SIZE or @ref PRESENT_KEY128_SIZE.
+ *
+ * @return True if the key is expanded, false if the key size is not
+ *         supported.
+ */
+bool
+present_key_setup(present_ctx_t * p_ctx, uint8_t const * p_key, \
+                  size_t key_size);
+
+/**
+ * @brief Expands a batch of crypt keys.
+ *
+ * The function expands \a count keys of the same size stored back to back
+ * in the buffer pointed by \a p_keys, and stores key i in the context
+ * \a p_ctx[i]. The result is the same as calling @ref present_key_setup
+ * for every key. The SSSE3 and AVX2 engines run the key schedules of
+ * several keys in the lanes of a register.
+ *
+ * @warning The function assumes parameter \a p_keys points a memory block
+ *          with length of \a count times \a key_size.
+ *
+ * @param[out] p_ctx    Pointer of the crypt contexts.
+ * @param[in]  p_keys   Pointer of the crypt keys.
+ * @param[in]  key_size Size of a key in byte. Either
+ *                      @ref PRESENT_KEY80_SIZE or @ref PRESENT_KEY128_SIZE.
+ * @param[in]  count    Count of the keys.
+ *
+ * @return True if the keys are expanded, false if the key size is not
+ *         supported.
+ */
+bool
+present_key_setup_batch(present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                        size_t key_size, size_t count);
+
+/**
+ * @brief Sets the round count of the context.
+ *
+ * The function changes the round count of the crypt functions that use
+ * the context pointed by \a p_ctx. The key schedule is not expanded again.
+ * The round count of @ref PRESENT_ROUND_COUNT runs through the specialized
+ * kernels of the engines; the other round counts run through the generic
+ * ones.
+ *
+ * @param[in,out] p_ctx  Pointer of the crypt context.
+ * @param[in]     rounds The round count, from @ref PRESENT_ROUND_COUNT_MIN
+ *                       to @ref PRESENT_ROUND_COUNT_MAX.
+ *
+ * @return True if the round count is set, false if it is out of range.
+ */
+bool
+present_set_round_count(present_ctx_t * p_ctx, uint8_t rounds);
+
+/**
+ * @brief Encrypts the raw text block with an expanded key.
+ *
+ * The function encrypts the raw text block pointed by \a p_text with the
+ * key schedule of the context pointed by \a p_ctx. The function encrypts
+ * only one block of data with length of @ref PRESENT_CRYPT_SIZE per call.
+ *
+ * @warning The function assumes parameter \a p_text points a memory block
+ *          with length of @ref PRESENT_CRYPT_SIZE.
+ *
+ * @param[in]     p_ctx  Pointer of the crypt context.
+ * @param[in,out] p_text Pointer of the text block.
+ *
+ * @return None.
+ */
+void
+present_ctx_encrypt(present_ctx_t const * p_ctx, uint8_t * p_text);
+
+/**
+ * @brief Decrypts the crypted text block with an expanded key.
+ *
+ * The function decrypts the crypted text block pointed by \a p_text with
+ * the key schedule of the context pointed by \a p_ctx. The function
+ * decrypts only one block of data with length of @ref PRESENT_CRYPT_SIZE
+ * per call.
+ *
+ * @warning The function assumes parameter \a p_text points a memory block
+ *          with length of @ref PRESENT_CRYPT_SIZE.
+ *
+ * @param[in]     p_ctx  Pointer of the crypt context.
+ * @param[in,out] p_text Pointer of the text block.
+ *
+ * @return None.
+ */
+void
+present_ctx_decrypt(present_ctx_t const * p_ctx, uint8_t * p_text);
+
+/**
+ * @brief Encrypts the raw text block out of place with an expanded key.
+ *
+ * The function encrypts the raw text block pointed by \a p_src with the
+ * key schedule of the context pointed by \a p_ctx and writes the result to
+ * the block pointed by \a p_dst. The raw text block is not changed. The
+ * blocks have no alignment requirement.
+ *
+ * @warning The blocks must either be the same or not overlap.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the crypted text block.
+ * @param[in]  p_src Pointer of the raw text block.
+ *
+ * @return None.
+ */
+void
+present_ctx_encrypt_to(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                       uint8_t const * p_src);
+
+/**
+ * @brief Decrypts the crypted text block out of place with an expanded key.
+ *
+ * The function decrypts the crypted text block pointed by \a p_src with the
+ * key schedule of the context pointed by \a p_ctx and writes the result to
+ * the block pointed by \a p_dst. The crypted text block is not changed.
+ * The blocks have no alignment requirement.
+ *
+ * @warning The blocks must either be the same or not overlap.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the raw text block.
+ * @param[in]  p_src Pointer of the crypted text block.
+ *
+ * @return None.
+ */
+void
+present_ctx_decrypt_to(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                       uint8_t const * p_src);
+
+/**
+ * @brief Encrypts consecutive text blocks with an expanded key.
+ *
+ * The function encrypts \a count blocks of the buffer pointed by \a p_src
+ * in ECB mode with the key schedule of the context pointed by \a p_ctx and
+ * writes the result to the buffer pointed by \a p_dst.
+ *
+ * @warning The function assumes parameters \a p_dst and \a p_src point
+ *          memory blocks with length of \a count times
+ *          @ref PRESENT_CRYPT_SIZE. The buffers must either be the same or
+ *          not overlap.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the crypted text buffer.
+ * @param[in]  p_src Pointer of the raw text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+void
+present_encrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                       uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with an expanded key.
+ *
+ * The function decrypts \a count blocks of the buffer pointed by \a p_src
+ * in ECB mode with the key schedule of the context pointed by \a p_ctx and
+ * writes the result to the buffer pointed by \a p_dst.
+ *
+ * @warning The function assumes parameters \a p_dst and \a p_src point
+ *          memory blocks with length of \a count times
+ *          @ref PRESENT_CRYPT_SIZE. The buffers must either be the same or
+ *          not overlap.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the raw text buffer.
+ * @param[in]  p_src Pointer of the crypted text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+void
+present_decrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                       uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Encrypts consecutive text blocks with different keys.
+ *
+ * The function encrypts \a count blocks of the buffer pointed by \a p_src
+ * in ECB mode and writes the result to the buffer pointed by \a p_dst.
+ * Block i is encrypted with the key schedule of the context pointed by
+ * \a pp_ctx[i]. The SIMD engines process the blocks of different keys in
+ * the lanes of the same register; the other engines process them one by
+ * one.
+ *
+ * @warning The buffers must either be the same or not overlap.
+ *
+ * @param[in]  pp_ctx Pointer of the crypt contexts of the blocks.
+ * @param[out] p_dst  Pointer of the crypted text buffer.
+ * @param[in]  p_src  Pointer of the raw text buffer.
+ * @param[in]  count  Count of the blocks.
+ *
+ * @return True if the blocks are encrypted, false if the contexts have
+ *         different round counts.
+ */
+bool
+present_encrypt_multi(present_ctx_t const * const * pp_ctx, uint8_t * p_dst, \
+                      uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with different keys.
+ *
+ * The function decrypts \a count blocks of the buffer pointed by \a p_src
+ * in ECB mode and writes the result to the buffer pointed by \a p_dst.
+ * Block i is decrypted with the key schedule of the context pointed by
+ * \a pp_ctx[i].
+ *
+ * @warning The buffers must either be the same or not overlap.
+ *
+ * @param[in]  pp_ctx Pointer of the crypt contexts of the blocks.
+ * @param[out] p_dst  Pointer of the raw text buffer.
+ * @param[in]  p_src  Pointer of the crypted text buffer.
+ * @param[in]  count  Count of the blocks.
+ *
+ * @return True if the blocks are decrypted, false if the contexts have
+ *         different round counts.
+ */
+bool
+present_decrypt_multi(present_ctx_t const * const * pp_ctx, uint8_t * p_dst, \
+                      uint8_t const * p_src, size_t count);
+
 /**
  * @brief Encrypts the raw text block.
  *
@@ -102,6 +463,10 @@ extern "C" {
  * of the function is described in the article. For further information,
  * see the article.
  *
+ * @note The function expands the key at every call. To encrypt several
+ *       blocks with the same key, use @ref present_key_setup and
+ *       @ref present_ctx_encrypt instead.
+ *
  * @warning The function assumes parameter \a p_text points a memory block
  *          with length of @ref PRESENT_CRYPT_SIZE and parameter \a p_key
  *          points a memory block with length of @ref PRESENT_KEY_SIZE.
@@ -123,6 +488,10 @@ present_encrypt(uint8_t * p_text, uint8_t const * p_key);
  * Algorithm of the function is described in the article. For further
  * information, see the article.
  *
+ * @note The function expands the key at every call. To decrypt several
+ *       blocks with the same key, use @ref present_key_setup and
+ *       @ref present_ctx_decrypt instead.
+ *
  * @warning The function assumes parameter \a p_text points a memory block
  *          with length of @ref PRESENT_CRYPT_SIZE and parameter \a p_key
  *          points a memory block with length of @ref PRESENT_KEY_SIZE.
@@ -135,6 +504,46 @@ present_encrypt(uint8_t * p_text, uint8_t const * p_key);
 void
 present_decrypt(uint8_t * p_text, uint8_t const * p_key);
 
+/**
+ * @brief Encrypts the raw text block out of place.
+ *
+ * The function is the out of place version of @ref present_encrypt. The
+ * raw text block pointed by \a p_src is not changed, and the result is
+ * written to the block pointed by \a p_dst. The blocks have no alignment
+ * requirement.
+ *
+ * @warning The blocks must either be the same or not overlap.
+ *
+ * @param[out] p_dst Pointer of the crypted text block.
+ * @param[in]  p_src Pointer of the raw text block.
+ * @param[in]  p_key Pointer of the crypt key.
+ *
+ * @return None.
+ */
+void
+present_encrypt_to(uint8_t * p_dst, uint8_t const * p_src, \
+                   uint8_t const * p_key);
+
+/**
+ * @brief Decrypts the crypted text block out of place.
+ *
+ * The function is the out of place version of @ref present_decrypt. The
+ * crypted text block pointed by \a p_src is not changed, and the result is
+ * written to the block pointed by \a p_dst. The blocks have no alignment
+ * requirement.
+ *
+ * @warning The blocks must either be the same or not overlap.
+ *
+ * @param[out] p_dst Pointer of the raw text block.
+ * @param[in]  p_src Pointer of the crypted text block.
+ * @param[in]  p_key Pointer of the crypt key.
+ *
+ * @return None.
+ */
+void
+present_decrypt_to(uint8_t * p_dst, uint8_t const * p_src, \
+                   uint8_t const * p_key);
+
 #ifdef __cplusplus
 }
 #endif  /* __cplusplus */
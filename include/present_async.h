@@ -0,0 +1,353 @@
+/**
+ * @file present_async.h
+ * @brief Header file of the PRESENT asynchronous queue.
+ *
+ * The file is the C/C++ interface of the PRESENT asynchronous queue. The
+ * file contains global symbol and function declarations, data structures,
+ * type definitions, etc, of the module.
+ *
+ * A queue has a submission ring and a completion ring. The caller pushes
+ * the job entries to the submission ring and returns at once. The workers
+ * of the queue drain the submission ring, process the jobs and push an
+ * entry with the user tag of the job to the completion ring. The caller
+ * polls the completion ring, or waits on it, or watches the event file
+ * descriptor of the queue in its own event loop.
+ *
+ * Every job has a priority class with its own submission ring. The bulk
+ * jobs are processed in chunks of @ref PRESENT_ASYNC_CHUNK bytes, and a
+ * worker takes the waiting high priority jobs between two chunks. So, a
+ * high priority job waits at most one chunk on a busy queue. The latency
+ * of the jobs, from the submission to the completion, is collected in a
+ * histogram per class.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_ASYNC_H
+#define PRESENT_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+#if CONF_PRESENT_ASYNC
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <pthread.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+#include <present_sched.h>
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT asynchronous priority class type.
+ *
+ * This type selects the priority class of a job.
+ */
+typedef enum {
+    /*! Latency sensitive jobs. They are never split, so they should be
+        short. */
+    PRESENT_ASYNC_HIGH,
+    /*! Bulk jobs. They are split into chunks that give way to the high
+        priority jobs. */
+    PRESENT_ASYNC_BULK,
+    /*! Count of the priority classes. */
+    PRESENT_ASYNC_CLASSES
+} present_async_class_t;
+
+/**
+ * @brief PRESENT submission entry type.
+ *
+ * This type describes a message to process. The entry is copied into the
+ * submission ring, but the buffers must stay valid until the completion.
+ */
+typedef struct {
+    /*! Operation of the job. */
+    present_sched_op_t    op;
+    /*! Pointer of the crypt context. */
+    present_ctx_t const * p_ctx;
+    /*! Pointer of the output buffer. */
+    uint8_t *             p_dst;
+    /*! Pointer of the input buffer. */
+    uint8_t const *       p_src;
+    /*! Size of the message in byte. It must be a multiple of the block
+        size in ECB and CBC modes. */
+    size_t                size;
+    /*! Initialization vector of the CBC mode, or the initial counter block
+        of the counter mode. */
+    uint8_t               iv[PRESENT_CRYPT_SIZE];
+    /*! Bit count of the counter part of the counter mode. */
+    uint8_t               counter_bits;
+    /*! Priority class of the job. */
+    present_async_class_t priority;
+    /*! Tag of the job. It is passed back in the completion entry. */
+    uint64_t              user_data;
+} present_async_sqe_t;
+
+/**
+ * @brief PRESENT completion entry type.
+ *
+ * This type tells the result of a job.
+ */
+typedef struct {
+    /*! Tag of the job. */
+    uint64_t user_data;
+    /*! True if the job is valid and processed. */
+    bool     ok;
+} present_async_cqe_t;
+
+/**
+ * @brief PRESENT latency histogram type.
+ *
+ * This type counts the latencies of the jobs of a class on a logarithmic
+ * scale. The bucket i holds the latencies from 2^i to 2^(i+1) - 1
+ * nanoseconds, and the last bucket holds all the longer ones.
+ */
+typedef struct {
+    /*! Counts of the jobs per latency range. */
+    unsigned long buckets[PRESENT_ASYNC_HIST_BUCKETS];
+    /*! Count of the jobs. */
+    unsigned long count;
+    /*! Sum of the latencies in nanosecond. */
+    uint64_t      total_ns;
+} present_async_hist_t;
+
+/**
+ * @brief PRESENT asynchronous job type.
+ *
+ * This type is an entry of a submission ring.
+ */
+typedef struct {
+    /*! Submission entry of the job. */
+    present_async_sqe_t sqe;
+    /*! Submission time of the job in nanosecond. */
+    uint64_t            submit_ns;
+} present_async_job_t;
+
+/**
+ * @brief PRESENT asynchronous ring type.
+ *
+ * This type holds the positions of a bounded ring that many threads push
+ * to and pop from without a lock. The entries are kept in a separate
+ * array of the same length.
+ */
+typedef struct {
+    /*! Position of the next pop. */
+    size_t head;
+    /*! Position of the next push. */
+    size_t tail;
+    /*! Sequence numbers of the entries. An entry is free for the push at
+        position p when its number is p, and full for the pop at position p
+        when its number is p + 1. */
+    size_t seq[PRESENT_ASYNC_ENTRIES];
+} present_async_ring_t;
+
+/**
+ * @brief PRESENT asynchronous queue type.
+ *
+ * This type holds the rings and the workers of a queue. It is initialized
+ * by @ref present_async_init. The fields are only accessed by the queue
+ * functions.
+ */
+typedef struct {
+    /*! Worker threads. */
+    pthread_t            workers[PRESENT_ASYNC_THREADS_MAX];
+    /*! Count of the worker threads. */
+    size_t               worker_count;
+    /*! Submission rings per class. */
+    present_async_ring_t sq[PRESENT_ASYNC_CLASSES];
+    /*! Entries of the submission rings. */
+    present_async_job_t  jobs[PRESENT_ASYNC_CLASSES][PRESENT_ASYNC_ENTRIES];
+    /*! Completion ring. */
+    present_async_ring_t cq;
+    /*! Entries of the completion ring. */
+    present_async_cqe_t  cqes[PRESENT_ASYNC_ENTRIES];
+    /*! Count of the jobs that are submitted but not reaped. */
+    size_t               inflight;
+    /*! Latency histograms per class. */
+    present_async_hist_t hists[PRESENT_ASYNC_CLASSES];
+    /*! Event file descriptor, or -1 if the host has none. */
+    int                  event_fd;
+    /*! Lock of the sleep conditions. */
+    pthread_mutex_t      lock;
+    /*! Condition that wakes the idle workers up. */
+    pthread_cond_t       wake;
+    /*! Condition that wakes the waiting callers up. */
+    pthread_cond_t       ready;
+    /*! Count of the sleeping workers. */
+    size_t               sleepers;
+    /*! Count of the waiting callers. */
+    size_t               waiters;
+    /*! True if the workers should exit. */
+    bool                 stop;
+} present_async_t;
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Initializes the asynchronous queue.
+ *
+ * The function sets the rings up and starts the workers of the queue
+ * pointed by \a p_async.
+ *
+ * @param[out] p_async Pointer of the queue.
+ * @param[in]  threads Count of the workers. Zero selects the count of the
+ *                     online CPUs. It is limited by
+ *                     @ref PRESENT_ASYNC_THREADS_MAX.
+ *
+ * @return True if the queue is started, false if a resource could not be
+ *         allocated.
+ */
+bool
+present_async_init(present_async_t * p_async, size_t threads);
+
+/**
+ * @brief Stops the asynchronous queue.
+ *
+ * The function lets the workers finish the submitted jobs, joins them and
+ * releases the resources of the queue pointed by \a p_async. The
+ * completions that are not reaped are dropped.
+ *
+ * @param[in,out] p_async Pointer of the queue.
+ *
+ * @return None.
+ */
+void
+present_async_destroy(present_async_t * p_async);
+
+/**
+ * @brief Gets the event file descriptor of the queue.
+ *
+ * The descriptor becomes readable when a completion is posted, so it
+ * could be added to an event loop like poll() or epoll. It is reset by
+ * @ref present_async_reap and @ref present_async_wait. The caller must not
+ * close it.
+ *
+ * @param[in] p_async Pointer of the queue.
+ *
+ * @return The descriptor, or -1 on the hosts other than Linux.
+ */
+int
+present_async_fd(present_async_t const * p_async);
+
+/**
+ * @brief Submits jobs to the queue.
+ *
+ * The function pushes the \a count entries pointed by \a p_sqes to the
+ * submission rings of their classes, and wakes the idle workers up. It
+ * does not block.
+ *
+ * @param[in,out] p_async Pointer of the queue.
+ * @param[in]     p_sqes  Pointer of the submission entries.
+ * @param[in]     count   Count of the entries.
+ *
+ * @return Count of the submitted entries from the beginning of the array.
+ *         It is less than \a count if @ref PRESENT_ASYNC_ENTRIES jobs are
+ *         in flight.
+ */
+size_t
+present_async_submit(present_async_t * p_async, \
+                     present_async_sqe_t const * p_sqes, size_t count);
+
+/**
+ * @brief Takes the posted completions.
+ *
+ * The function pops up to \a max entries of the completion ring without
+ * blocking. The completions are posted in the order the jobs end, not the
+ * order they are submitted.
+ *
+ * @param[in,out] p_async Pointer of the queue.
+ * @param[out]    p_cqes  Pointer of the completion entries.
+ * @param[in]     max     Maximum count of the entries.
+ *
+ * @return Count of the taken entries.
+ */
+size_t
+present_async_reap(present_async_t * p_async, present_async_cqe_t * p_cqes, \
+                   size_t max);
+
+/**
+ * @brief Waits for the completions.
+ *
+ * The function is the blocking version of @ref present_async_reap. It
+ * returns when at least one entry is taken, or no job is in flight.
+ *
+ * @param[in,out] p_async Pointer of the queue.
+ * @param[out]    p_cqes  Pointer of the completion entries.
+ * @param[in]     max     Maximum count of the entries. It must not be zero.
+ *
+ * @return Count of the taken entries.
+ */
+size_t
+present_async_wait(present_async_t * p_async, present_async_cqe_t * p_cqes, \
+                   size_t max);
+
+/**
+ * @brief Gets the latency histogram of a class.
+ *
+ * The function copies the histogram of the jobs of the class \a priority
+ * that are done since the initialization of the queue.
+ *
+ * @param[in]  p_async  Pointer of the queue.
+ * @param[in]  priority Priority class.
+ * @param[out] p_hist   Pointer of the histogram.
+ *
+ * @return None.
+ */
+void
+present_async_hist(present_async_t * p_async, \
+                   present_async_class_t priority, \
+                   present_async_hist_t * p_hist);
+
+/**
+ * @brief Gets a percentile of a latency histogram.
+ *
+ * @param[in] p_hist  Pointer of the histogram.
+ * @param[in] percent Percentile, from 1 to 100.
+ *
+ * @return The upper bound of the bucket of the percentile in nanosecond,
+ *         or zero if the histogram is empty.
+ */
+uint64_t
+present_async_percentile(present_async_hist_t const * p_hist, \
+                         unsigned percent);
+
+#endif  /* CONF_PRESENT_ASYNC */
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_ASYNC_H */
+
+/*** END OF FILE ***/
@@ -0,0 +1,189 @@
+/**
+ * @file present_cache.h
+ * @brief Header file of the PRESENT expanded key cache.
+ *
+ * The file is the C/C++ interface of the PRESENT expanded key cache. The
+ * file contains global symbol and function declarations, data structures,
+ * type definitions, etc, of the module.
+ *
+ * The cache maps raw keys to their expanded crypt contexts, so that the
+ * servers with many keys do not run the key schedule at every request. The
+ * memory of the cache is given by the caller, so the cache never grows.
+ * The slots are grouped into sets of @ref PRESENT_CACHE_WAYS slots, and a
+ * full set evicts its slots with the CLOCK algorithm.
+ *
+ * Lookups are lock-free: every slot is protected by a sequence counter, and
+ * a reader retries if the slot was written during the read. Insertions are
+ * serialized by a spin lock, which is only taken on a miss.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_CACHE_H
+#define PRESENT_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+
+/*****************************************************************************/
+/* GLOBAL SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Alignment specifier of the fields that must start a cache line.
+ */
+#if defined(__GNUC__)
+#   define PRESENT_CACHE_ALIGNED __attribute__((aligned(PRESENT_CACHE_LINE)))
+#else
+#   define PRESENT_CACHE_ALIGNED
+#endif  /* __GNUC__ */
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT key cache slot type.
+ *
+ * This type holds a raw key and its expanded context. The fields are only
+ * accessed by the cache functions.
+ */
+typedef struct {
+    /*! Sequence counter of the slot. It is odd while the slot is written. */
+    unsigned int  sequence;
+    /*! Reference flag of the CLOCK eviction. */
+    unsigned char referenced;
+    /*! Way that the CLOCK hand of the set points at. It is only used in
+        the first slot of a set. */
+    unsigned char hand;
+    /*! Spin lock of the insertions into the set. It is only used in the
+        first slot of a set. */
+    unsigned char lock;
+    /*! Size of the key in byte. Zero if the slot is empty. */
+    unsigned char key_size;
+    /*! The raw key. */
+    uint8_t       key[PRESENT_KEY128_SIZE];
+    /*! The expanded context of the key. */
+    present_ctx_t ctx;
+} present_cache_slot_t;
+
+/**
+ * @brief PRESENT key cache counter type.
+ *
+ * This type holds the lookup counts of a group of threads. It fills a
+ * whole cache line, so that the threads of two groups never write the
+ * same line.
+ */
+typedef struct {
+    /*! Count of the lookups that found the key. */
+    unsigned long hits;
+    /*! Count of the lookups that expanded the key. */
+    unsigned long misses;
+} PRESENT_CACHE_ALIGNED present_cache_counter_t;
+
+/**
+ * @brief PRESENT key cache type.
+ *
+ * This type holds the state of a cache. It is initialized by
+ * @ref present_cache_init.
+ */
+typedef struct {
+    /*! Pointer of the slots. */
+    present_cache_slot_t *  p_slots;
+    /*! Count of the sets. */
+    size_t                  set_count;
+    /*! Lookup counters of the thread groups. They start a new line, since
+        the fields above are read by every lookup. */
+    present_cache_counter_t counters[PRESENT_CACHE_STRIPES];
+} present_cache_t;
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Initializes the key cache.
+ *
+ * The function prepares the cache pointed by \a p_cache to use the slots
+ * pointed by \a p_slots. Only the multiple of @ref PRESENT_CACHE_WAYS of
+ * the slots are used. The slots must stay valid while the cache is used.
+ *
+ * @param[out] p_cache    Pointer of the cache.
+ * @param[out] p_slots    Pointer of the slots.
+ * @param[in]  slot_count Count of the slots. It must be at least
+ *                        @ref PRESENT_CACHE_WAYS.
+ *
+ * @return None.
+ */
+void
+present_cache_init(present_cache_t * p_cache, present_cache_slot_t * p_slots, \
+                   size_t slot_count);
+
+/**
+ * @brief Gets the expanded context of a key.
+ *
+ * The function copies the context of the key pointed by \a p_key to the
+ * context pointed by \a p_ctx. If the key is not in the cache, the key is
+ * expanded and inserted first. The function could be called by several
+ * threads at the same time.
+ *
+ * @param[in,out] p_cache  Pointer of the cache.
+ * @param[in]     p_key    Pointer of the crypt key.
+ * @param[in]     key_size Size of the key in byte.
+ * @param[out]    p_ctx    Pointer of the crypt context.
+ *
+ * @return True if the context is copied, false if the key size is not
+ *         supported.
+ */
+bool
+present_cache_get(present_cache_t * p_cache, uint8_t const * p_key, \
+                  size_t key_size, present_ctx_t * p_ctx);
+
+/**
+ * @brief Gets the hit and miss counts of the cache.
+ *
+ * The function reads the counters of the cache pointed by \a p_cache, so
+ * that the hit rate of a cache size could be measured.
+ *
+ * @param[in]  p_cache  Pointer of the cache.
+ * @param[out] p_hits   Pointer of the hit count.
+ * @param[out] p_misses Pointer of the miss count.
+ *
+ * @return None.
+ */
+void
+present_cache_stats(present_cache_t const * p_cache, unsigned long * p_hits, \
+                    unsigned long * p_misses);
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_CACHE_H */
+
+/*** END OF FILE ***/
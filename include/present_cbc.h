@@ -0,0 +1,106 @@
+/**
+ * @file present_cbc.h
+ * @brief Header file of the PRESENT cipher block chaining mode.
+ *
+ * The file is the C/C++ interface of the PRESENT cipher block chaining
+ * mode. The file contains global symbol and function declarations, data
+ * structures, type definitions, etc, of the module.
+ *
+ * The encryption is serial, since every block depends on the previous
+ * crypted block. The decryption is not: all blocks are decrypted through
+ * the active crypt engine at once, and then XORed with the previous
+ * crypted blocks.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_CBC_H
+#define PRESENT_CBC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Encrypts consecutive text blocks in CBC mode.
+ *
+ * The function encrypts \a count blocks of the buffer pointed by \a p_src
+ * in CBC mode with the key schedule of the context pointed by \a p_ctx and
+ * writes the result to the buffer pointed by \a p_dst. The initialization
+ * vector pointed by \a p_iv is replaced with the last crypted block, so
+ * that a message could be encrypted in parts.
+ *
+ * @warning The buffers must either be the same or not overlap.
+ *
+ * @param[in]     p_ctx Pointer of the crypt context.
+ * @param[in,out] p_iv  Pointer of the initialization vector with length of
+ *                      @ref PRESENT_CRYPT_SIZE.
+ * @param[out]    p_dst Pointer of the crypted text buffer.
+ * @param[in]     p_src Pointer of the raw text buffer.
+ * @param[in]     count Count of the blocks.
+ *
+ * @return None.
+ */
+void
+present_cbc_encrypt(present_ctx_t const * p_ctx, uint8_t * p_iv, \
+                    uint8_t * p_dst, uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks in CBC mode.
+ *
+ * The function decrypts \a count blocks of the buffer pointed by \a p_src
+ * in CBC mode with the key schedule of the context pointed by \a p_ctx and
+ * writes the result to the buffer pointed by \a p_dst. The initialization
+ * vector pointed by \a p_iv is replaced with the last crypted block, so
+ * that a message could be decrypted in parts.
+ *
+ * @warning The buffers must either be the same or not overlap.
+ *
+ * @param[in]     p_ctx Pointer of the crypt context.
+ * @param[in,out] p_iv  Pointer of the initialization vector with length of
+ *                      @ref PRESENT_CRYPT_SIZE.
+ * @param[out]    p_dst Pointer of the raw text buffer.
+ * @param[in]     p_src Pointer of the crypted text buffer.
+ * @param[in]     count Count of the blocks.
+ *
+ * @return None.
+ */
+void
+present_cbc_decrypt(present_ctx_t const * p_ctx, uint8_t * p_iv, \
+                    uint8_t * p_dst, uint8_t const * p_src, size_t count);
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_CBC_H */
+
+/*** END OF FILE ***/
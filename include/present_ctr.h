@@ -0,0 +1,152 @@
+/**
+ * @file present_ctr.h
+ * @brief Header file of the PRESENT counter mode.
+ *
+ * The file is the C/C++ interface of the PRESENT counter mode. The file
+ * contains global symbol and function declarations, data structures, type
+ * definitions, etc, of the module.
+ *
+ * The counter block is split into a nonce part and a counter part. The
+ * counter part is the least significant bits of the block, and it wraps
+ * around without changing the nonce part. The keystream is generated for
+ * many counters at once through the active crypt engine.
+ *
+ * A message could take at most 2^n blocks with an n-bit counter part. The
+ * next block would use a counter block again, and the same keystream would
+ * be XORed with two texts, which leaks the XOR of the texts. So, the crypt
+ * functions refuse the input past the counter space.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_CTR_H
+#define PRESENT_CTR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT counter mode state type.
+ *
+ * This type holds the counter and the unused keystream of a message. It is
+ * initialized by @ref present_ctr_init.
+ */
+typedef struct {
+    /*! Pointer of the crypt context. */
+    present_ctx_t const * p_ctx;
+    /*! Nonce part of the counter block. */
+    uint64_t              nonce;
+    /*! Counter part of the next counter block. */
+    uint64_t              counter;
+    /*! Mask of the counter part. */
+    uint64_t              counter_mask;
+    /*! Count of the counter blocks that are not used yet. It is
+        2^64 - 1 for a 64-bit counter part, which could never run out. */
+    uint64_t              remaining;
+    /*! Keystream of the last counter block. */
+    uint8_t               keystream[PRESENT_CRYPT_SIZE];
+    /*! Count of the used keystream bytes. */
+    uint8_t               used;
+} present_ctr_t;
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Initializes the counter mode state.
+ *
+ * The function prepares the state pointed by \a p_ctr for a message. The
+ * initial counter block pointed by \a p_iv holds both the nonce and the
+ * initial counter. Its \a counter_bits least significant bits are the
+ * counter part. The bits of the block are numbered as the text block bits.
+ *
+ * @warning The context pointed by \a p_ctx must stay valid while the state
+ *          is used.
+ *
+ * @param[out] p_ctr        Pointer of the counter mode state.
+ * @param[in]  p_ctx        Pointer of the crypt context.
+ * @param[in]  p_iv         Pointer of the initial counter block with length
+ *                          of @ref PRESENT_CRYPT_SIZE.
+ * @param[in]  counter_bits Bit size of the counter part, from 1 to 64.
+ *
+ * @return True if the state is initialized, false if the counter size is
+ *         out of range.
+ */
+bool
+present_ctr_init(present_ctr_t * p_ctr, present_ctx_t const * p_ctx, \
+                 uint8_t const * p_iv, uint8_t counter_bits);
+
+/**
+ * @brief Checks that a message part fits into the counter space.
+ *
+ * The function checks that \a size more bytes could be processed with the
+ * state pointed by \a p_ctr without using a counter block again.
+ *
+ * @param[in] p_ctr Pointer of the counter mode state.
+ * @param[in] size  Size of the message part in byte.
+ *
+ * @return True if the part fits, false otherwise.
+ */
+bool
+present_ctr_check(present_ctr_t const * p_ctr, size_t size);
+
+/**
+ * @brief Encrypts or decrypts a message part in counter mode.
+ *
+ * The function XORs \a size bytes of the buffer pointed by \a p_src with
+ * the keystream and writes the result to the buffer pointed by \a p_dst.
+ * The message could be processed in parts of any size, and the result is
+ * the same as processing it at once.
+ *
+ * @warning The buffers must either be the same or not overlap.
+ *
+ * @param[in,out] p_ctr Pointer of the counter mode state.
+ * @param[out]    p_dst Pointer of the output buffer.
+ * @param[in]     p_src Pointer of the input buffer.
+ * @param[in]     size  Size of the buffers in byte.
+ *
+ * @return True if the part is processed, false if it passes the counter
+ *         space. In that case, nothing is processed and the state is not
+ *         changed.
+ */
+bool
+present_ctr_crypt(present_ctr_t * p_ctr, uint8_t * p_dst, \
+                  uint8_t const * p_src, size_t size);
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_CTR_H */
+
+/*** END OF FILE ***/
@@ -0,0 +1,353 @@
+/**
+ * @file present_engine.h
+ * @brief Header file of the PRESENT crypt engines.
+ *
+ * The file is the internal interface between the PRESENT crypt module and
+ * its crypt engines. The file contains global symbol and function
+ * declarations, data structures, type definitions, etc, that are shared by
+ * the engines.
+ *
+ * Every engine implements the same multi-block crypt operations with a
+ * different technique. The module binds one of the engines to its global
+ * functions. Engines are not intended to be used directly by the
+ * application.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @see <a href=
+ *      "https://link.springer.com/chapter/10.1007%2F978-3-540-74735-2_31">
+ *      PRESENT: An Ultra-Lightweight Block Cipher</a>
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_ENGINE_H
+#define PRESENT_ENGINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+#include <cpu.h>
+
+/*****************************************************************************/
+/* COMMON MACRO FUNCTIONS                                                    */
+/*****************************************************************************/
+
+/**
+ * @brief Swaps the bit groups of a 64-bit word.
+ *
+ * The macro swaps the bits of \a x selected by \a mask with the bits that
+ * are \a delta positions higher. Every permutation of the algorithm is
+ * composed of a few of these swaps.
+ *
+ * @param[in] x     The 64-bit word.
+ * @param[in] mask  The mask of the lower bits of the swapped pairs.
+ * @param[in] delta The distance between the swapped bits.
+ *
+ * @return The swapped word.
+ */
+#define PRESENT_DELTA_SWAP(x, mask, delta)                                   \
+    ((x) ^ ((((x) >> (delta)) ^ (x)) & (mask))                               \
+         ^ (((((x) >> (delta)) ^ (x)) & (mask)) << (delta)))
+
+/**
+ * @brief Runs a crypt kernel with the round count of the context.
+ *
+ * The macro calls the kernel \a fn, which takes the round count as its
+ * last parameter. The default round count is passed as a constant, so that
+ * the inlined kernel of the common case is specialized for it.
+ *
+ * @param[in] fn    The kernel.
+ * @param[in] p_ctx Pointer of the crypt context.
+ * @param[in] p_dst Pointer of the destination buffer.
+ * @param[in] p_src Pointer of the source buffer.
+ * @param[in] count Count of the blocks.
+ */
+#define PRESENT_ROUND_DISPATCH(fn, p_ctx, p_dst, p_src, count)               \
+    do {                                                                     \
+        if (PRESENT_ROUND_COUNT == (p_ctx)->rounds)                          \
+        {                                                                    \
+            fn(p_ctx, p_dst, p_src, count, PRESENT_ROUND_COUNT);             \
+        }                                                                    \
+        else                                                                 \
+        {                                                                    \
+            fn(p_ctx, p_dst, p_src, count, (p_ctx)->rounds);                 \
+        }                                                                    \
+    } while (0)
+
+/*****************************************************************************/
+/* GLOBAL SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Masks and distances of the delta swaps that compose the permutation
+ * layer. Bit i of the text block moves to the bit 16 * (i % 4) + (i / 4),
+ * which is a rotation of the 6-bit bit index by two. The rotation is done
+ * by swapping the index bits (0, 2), (1, 3), (2, 4) and (3, 5) in order.
+ */
+#define PRESENT_PERM_MASK_1  (UINT64_C(0x0A0A0A0A0A0A0A0A))
+#define PRESENT_PERM_DELTA_1 (3u)
+#define PRESENT_PERM_MASK_2  (UINT64_C(0x00CC00CC00CC00CC))
+#define PRESENT_PERM_DELTA_2 (6u)
+#define PRESENT_PERM_MASK_3  (UINT64_C(0x0000F0F00000F0F0))
+#define PRESENT_PERM_DELTA_3 (12u)
+#define PRESENT_PERM_MASK_4  (UINT64_C(0x00000000FF00FF00))
+#define PRESENT_PERM_DELTA_4 (24u)
+
+/*
+ * Inline specifier of the kernels that must be specialized for the round
+ * count at every call.
+ */
+#if defined(__GNUC__)
+#   define PRESENT_INLINE __inline__ __attribute__((always_inline))
+#else
+#   define PRESENT_INLINE
+#endif  /* __GNUC__ */
+
+/*
+ * Count of the text blocks that the bitsliced engine processes in parallel.
+ */
+#define PRESENT_BITSLICE_LANES (64u)
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief Multi-block crypt function type of the engines.
+ *
+ * Functions of this type process \a count consecutive blocks of \a p_src
+ * with the key schedule of \a p_ctx and write them to \a p_dst. Buffers are
+ * either the same or not overlapping, and they have no alignment
+ * requirement.
+ */
+typedef void (*present_blocks_fn_t)(present_ctx_t const * p_ctx,
+                                    uint8_t *             p_dst,
+                                    uint8_t const *       p_src,
+                                    size_t                count);
+
+/**
+ * @brief Multi-key crypt function type of the engines.
+ *
+ * Functions of this type process \a count consecutive blocks of \a p_src
+ * and write them to \a p_dst. Block i is processed with the key schedule
+ * of \a pp_ctx[i]. All the contexts have the same round count.
+ */
+typedef void (*present_multi_fn_t)(present_ctx_t const * const * pp_ctx,
+                                   uint8_t *                     p_dst,
+                                   uint8_t const *               p_src,
+                                   size_t                        count);
+
+/**
+ * @brief Batch key setup function type of the engines.
+ *
+ * Functions of this type expand \a count consecutive keys of \a p_keys,
+ * each \a key_size bytes long, into the consecutive contexts of \a p_ctx.
+ * The key size is either @ref PRESENT_KEY80_SIZE or
+ * @ref PRESENT_KEY128_SIZE.
+ */
+typedef void (*present_keys_fn_t)(present_ctx_t * p_ctx,
+                                  uint8_t const * p_keys,
+                                  size_t          key_size,
+                                  size_t          count);
+
+/**
+ * @brief PRESENT crypt engine type.
+ *
+ * This type describes an implementation of the multi-block crypt
+ * operations.
+ */
+typedef struct {
+    /*! Name of the engine. */
+    char const *        p_name;
+    /*! CPU features that are required by the engine. */
+    unsigned int        features;
+    /*! Multi-block encryption function of the engine. */
+    present_blocks_fn_t encrypt;
+    /*! Multi-block decryption function of the engine. */
+    present_blocks_fn_t decrypt;
+    /*! Multi-key encryption function of the engine. NULL if the engine
+        processes the blocks of different keys one by one. */
+    present_multi_fn_t  encrypt_multi;
+    /*! Multi-key decryption function of the engine. NULL if the engine
+        processes the blocks of different keys one by one. */
+    present_multi_fn_t  decrypt_multi;
+    /*! Batch key setup function of the engine. NULL if the engine expands
+        the keys one by one. */
+    present_keys_fn_t   key_setup;
+} present_engine_t;
+
+/*****************************************************************************/
+/* GLOBAL VARIABLES                                                          */
+/*****************************************************************************/
+
+/**
+ * Lookup table for PRESENT substitution process.
+ */
+extern uint8_t const g_sbox[16];
+
+/**
+ * Lookup table for PRESENT inverse substitution process.
+ */
+extern uint8_t const g_sbox_inv[16];
+
+/**
+ * Reference engine which processes the text block byte by byte.
+ */
+extern present_engine_t const g_present_engine_ref;
+
+/**
+ * Engine which keeps the text block in a 64-bit word during all rounds.
+ */
+extern present_engine_t const g_present_engine_word;
+
+/**
+ * Engine which merges the substitution and the permutation layers into
+ * lookup tables.
+ */
+extern present_engine_t const g_present_engine_table;
+
+/**
+ * Engine which processes @ref PRESENT_BITSLICE_LANES blocks in parallel in
+ * the bitsliced layout.
+ */
+extern present_engine_t const g_present_engine_bitslice;
+
+#if CPU_USE_X86
+/**
+ * Engine which processes two blocks per SSSE3 register.
+ */
+extern present_engine_t const g_present_engine_ssse3;
+
+/**
+ * Engine which processes four blocks per AVX2 register.
+ */
+extern present_engine_t const g_present_engine_avx2;
+#endif  /* CPU_USE_X86 */
+
+/*****************************************************************************/
+/* GLOBAL INLINE FUNCTION DEFINITIONS                                        */
+/*****************************************************************************/
+
+/**
+ * @brief Loads a text block into a 64-bit word.
+ *
+ * The function reads the text block pointed by \a p_text as a little-endian
+ * 64-bit word, so that the bit i of the word is the bit i of the block. The
+ * pointer has no alignment requirement.
+ *
+ * @param[in] p_text Pointer of the text block.
+ *
+ * @return The 64-bit word.
+ */
+static inline uint64_t
+present_load64 (uint8_t const * p_text)
+{
+    return ((uint64_t)p_text[0] <<  0) | ((uint64_t)p_text[1] <<  8) \
+           | ((uint64_t)p_text[2] << 16) | ((uint64_t)p_text[3] << 24) \
+           | ((uint64_t)p_text[4] << 32) | ((uint64_t)p_text[5] << 40) \
+           | ((uint64_t)p_text[6] << 48) | ((uint64_t)p_text[7] << 56);
+}  /* present_load64() */
+
+/**
+ * @brief Stores a 64-bit word into a text block.
+ *
+ * The function writes \a state to the text block pointed by \a p_text as a
+ * little-endian 64-bit word. The pointer has no alignment requirement.
+ *
+ * @param[out] p_text Pointer of the text block.
+ * @param[in]  state  The 64-bit word.
+ *
+ * @return None.
+ */
+static inline void
+present_store64 (uint8_t * p_text, uint64_t state)
+{
+    p_text[0] = (uint8_t)(state >>  0);
+    p_text[1] = (uint8_t)(state >>  8);
+    p_text[2] = (uint8_t)(state >> 16);
+    p_text[3] = (uint8_t)(state >> 24);
+    p_text[4] = (uint8_t)(state >> 32);
+    p_text[5] = (uint8_t)(state >> 40);
+    p_text[6] = (uint8_t)(state >> 48);
+    p_text[7] = (uint8_t)(state >> 56);
+}  /* present_store64() */
+
+/**
+ * @brief Permutation layer of the encryption on a 64-bit word.
+ *
+ * The function moves all the bits of \a state to their new positions with
+ * four delta swaps. For further information about the permutation layer,
+ * see article's section 3.
+ *
+ * @param[in] state The text block.
+ *
+ * @return The permutated text block.
+ */
+static inline uint64_t
+present_permute64 (uint64_t state)
+{
+    state = PRESENT_DELTA_SWAP(state, PRESENT_PERM_MASK_1, \
+                               PRESENT_PERM_DELTA_1);
+    state = PRESENT_DELTA_SWAP(state, PRESENT_PERM_MASK_2, \
+                               PRESENT_PERM_DELTA_2);
+    state = PRESENT_DELTA_SWAP(state, PRESENT_PERM_MASK_3, \
+                               PRESENT_PERM_DELTA_3);
+    state = PRESENT_DELTA_SWAP(state, PRESENT_PERM_MASK_4, \
+                               PRESENT_PERM_DELTA_4);
+
+    return state;
+}  /* present_permute64() */
+
+/**
+ * @brief Permutation layer of the decryption on a 64-bit word.
+ *
+ * The function reverts @ref present_permute64 by applying the same delta
+ * swaps in reverse order.
+ *
+ * @param[in] state The text block.
+ *
+ * @return The permutated text block.
+ */
+static inline uint64_t
+present_permute64_inv (uint64_t state)
+{
+    state = PRESENT_DELTA_SWAP(state, PRESENT_PERM_MASK_4, \
+                               PRESENT_PERM_DELTA_4);
+    state = PRESENT_DELTA_SWAP(state, PRESENT_PERM_MASK_3, \
+                               PRESENT_PERM_DELTA_3);
+    state = PRESENT_DELTA_SWAP(state, PRESENT_PERM_MASK_2, \
+                               PRESENT_PERM_DELTA_2);
+    state = PRESENT_DELTA_SWAP(state, PRESENT_PERM_MASK_1, \
+                               PRESENT_PERM_DELTA_1);
+
+    return state;
+}  /* present_permute64_inv() */
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_ENGINE_H */
+
+/*** END OF FILE ***/
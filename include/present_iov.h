@@ -0,0 +1,117 @@
+/**
+ * @file present_iov.h
+ * @brief Header file of the PRESENT scatter-gather interface.
+ *
+ * The file is the C/C++ interface of the PRESENT scatter-gather interface.
+ * The file contains global symbol and function declarations, data
+ * structures, type definitions, etc, of the module.
+ *
+ * The functions take the input and the output as chains of buffers, which
+ * need not have the same layout. The blocks that straddle the buffer
+ * boundaries are carried by the states of the stream modes, and the full
+ * blocks inside a buffer are processed from the buffer directly.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_IOV_H
+#define PRESENT_IOV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+#if CONF_PRESENT_IOV
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <sys/uio.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present_ctr.h>
+#include <present_stream.h>
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Encrypts or decrypts a buffer chain in counter mode.
+ *
+ * The function is the scatter-gather version of @ref present_ctr_crypt.
+ * All the bytes of the input chain are processed and written to the output
+ * chain in order.
+ *
+ * @warning The output chain must have room for all the bytes of the input
+ *          chain. The buffers of the chains must not overlap.
+ *
+ * @param[in,out] p_ctr     Pointer of the counter mode state.
+ * @param[in]     p_dst     Pointer of the output buffer chain.
+ * @param[in]     dst_count Count of the output buffers.
+ * @param[in]     p_src     Pointer of the input buffer chain.
+ * @param[in]     src_count Count of the input buffers.
+ *
+ * @return True if the chain is processed, false if it passes the counter
+ *         space. In that case, nothing is processed.
+ */
+bool
+present_ctr_crypt_iov(present_ctr_t * p_ctr, struct iovec const * p_dst, \
+                      size_t dst_count, struct iovec const * p_src, \
+                      size_t src_count);
+
+/**
+ * @brief Processes a buffer chain of a message.
+ *
+ * The function is the scatter-gather version of
+ * @ref present_stream_update. The output is written to the output chain in
+ * order, from its beginning.
+ *
+ * @warning The output chain must have room for all the bytes of the input
+ *          chain plus @ref PRESENT_CRYPT_SIZE bytes. The buffers of the
+ *          chains must not overlap.
+ *
+ * @param[in,out] p_stream  Pointer of the stream state.
+ * @param[in]     p_dst     Pointer of the output buffer chain.
+ * @param[in]     dst_count Count of the output buffers.
+ * @param[in]     p_src     Pointer of the input buffer chain.
+ * @param[in]     src_count Count of the input buffers.
+ *
+ * @return Count of the bytes written to the output chain.
+ */
+size_t
+present_stream_update_iov(present_stream_t * p_stream, \
+                          struct iovec const * p_dst, size_t dst_count, \
+                          struct iovec const * p_src, size_t src_count);
+
+#endif  /* CONF_PRESENT_IOV */
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_IOV_H */
+
+/*** END OF FILE ***/
@@ -0,0 +1,153 @@
+/**
+ * @file present_mb.h
+ * @brief Header file of the PRESENT multi-buffer manager.
+ *
+ * The file is the C/C++ interface of the PRESENT multi-buffer manager. The
+ * file contains global symbol and function declarations, data structures,
+ * type definitions, etc, of the module.
+ *
+ * A CBC encryption or a CBC-MAC is serial inside a message, but the
+ * messages are independent. The manager holds up to @ref PRESENT_MB_LANES
+ * jobs of different messages, and advances all of them by one block per
+ * engine call, so that the parallel engines get a block in every lane.
+ *
+ * The jobs are submitted one by one. A job is returned once it is done,
+ * which is not necessarily in the submission order.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_MB_H
+#define PRESENT_MB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT multi-buffer job type.
+ *
+ * This type describes a CBC encryption or a CBC-MAC of a message. The
+ * fields are filled by the caller before the job is submitted, and the job
+ * must stay valid until it is returned by the manager.
+ */
+typedef struct {
+    /*! Pointer of the crypted text buffer. If it is NULL, only the CBC-MAC
+        of the message is computed. */
+    uint8_t *       p_dst;
+    /*! Pointer of the raw text buffer. */
+    uint8_t const * p_src;
+    /*! Count of the blocks. */
+    size_t          count;
+    /*! The initialization vector. When the job is done, it holds the last
+        crypted block, which is the CBC-MAC of the message. */
+    uint8_t         chain[PRESENT_CRYPT_SIZE];
+    /*! Pointer of the caller data. It is not used by the manager. */
+    void *          p_user;
+} present_mb_job_t;
+
+/**
+ * @brief PRESENT multi-buffer manager type.
+ *
+ * This type holds the jobs in the lanes of a manager. It is initialized by
+ * @ref present_mb_init.
+ */
+typedef struct {
+    /*! Pointer of the crypt context of all jobs. */
+    present_ctx_t const * p_ctx;
+    /*! Jobs of the lanes. NULL if the lane is free. */
+    present_mb_job_t *    p_jobs[PRESENT_MB_LANES];
+    /*! Count of the processed blocks of the lanes. */
+    size_t                done[PRESENT_MB_LANES];
+    /*! Count of the busy lanes. */
+    size_t                busy;
+} present_mb_mgr_t;
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Initializes the multi-buffer manager.
+ *
+ * The function prepares the manager pointed by \a p_mgr for the jobs that
+ * use the key schedule of the context pointed by \a p_ctx.
+ *
+ * @warning The context pointed by \a p_ctx must stay valid while the
+ *          manager is used.
+ *
+ * @param[out] p_mgr Pointer of the manager.
+ * @param[in]  p_ctx Pointer of the crypt context.
+ *
+ * @return None.
+ */
+void
+present_mb_init(present_mb_mgr_t * p_mgr, present_ctx_t const * p_ctx);
+
+/**
+ * @brief Submits a job to the multi-buffer manager.
+ *
+ * The function places the job pointed by \a p_job into a free lane. If all
+ * the lanes are busy after that, the jobs are advanced until one of them
+ * is done.
+ *
+ * @warning The manager must have a free lane, which is always the case if
+ *          the jobs returned by the manager are not ignored.
+ *
+ * @param[in,out] p_mgr Pointer of the manager.
+ * @param[in,out] p_job Pointer of the job.
+ *
+ * @return Pointer of a done job, or NULL if no job is done yet.
+ */
+present_mb_job_t *
+present_mb_submit(present_mb_mgr_t * p_mgr, present_mb_job_t * p_job);
+
+/**
+ * @brief Flushes a job of the multi-buffer manager.
+ *
+ * The function advances the jobs in the lanes until one of them is done,
+ * even if the lanes are not full. It is called until it returns NULL to
+ * finish all the submitted jobs.
+ *
+ * @param[in,out] p_mgr Pointer of the manager.
+ *
+ * @return Pointer of a done job, or NULL if the manager has no job.
+ */
+present_mb_job_t *
+present_mb_flush(present_mb_mgr_t * p_mgr);
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_MB_H */
+
+/*** END OF FILE ***/
@@ -0,0 +1,182 @@
+/**
+ * @file present_numa.h
+ * @brief Header file of the PRESENT NUMA support.
+ *
+ * The file is the C/C++ interface of the PRESENT NUMA support. The file
+ * contains global symbol and function declarations, data structures, type
+ * definitions, etc, of the module.
+ *
+ * The module reads the NUMA topology of the host from the sysfs, finds and
+ * sets the nodes of the memory pages by the move_pages system call, and
+ * allocates the buffers on huge pages. No external library is used. On
+ * the hosts other than Linux, the topology is a single node and the pages
+ * are not moved.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_NUMA_H
+#define PRESENT_NUMA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+#if CONF_PRESENT_NUMA
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT NUMA topology type.
+ *
+ * This type holds the nodes that have CPUs, and the node of every CPU. A
+ * node is referred by its index in \a nodes, not by its system ID. It is
+ * initialized by @ref present_numa_init.
+ */
+typedef struct {
+    /*! System IDs of the nodes. */
+    int     nodes[PRESENT_NUMA_NODES_MAX];
+    /*! Count of the nodes. It is one if the topology is unknown. */
+    size_t  node_count;
+    /*! Node indexes of the CPUs. */
+    uint8_t cpu_nodes[PRESENT_NUMA_CPUS_MAX];
+} present_numa_t;
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Reads the NUMA topology.
+ *
+ * The function reads the CPU lists of the nodes from the sysfs to the
+ * topology pointed by \a p_numa. If the sysfs has no node, the topology is
+ * set to a single node with all the CPUs.
+ *
+ * @param[out] p_numa Pointer of the topology.
+ *
+ * @return True if the topology is read, false if it is unknown.
+ */
+bool
+present_numa_init(present_numa_t * p_numa);
+
+/**
+ * @brief Gets the node of the calling thread.
+ *
+ * @param[in] p_numa Pointer of the topology.
+ *
+ * @return Index of the node of the CPU that runs the caller, or zero if it
+ *         is unknown.
+ */
+size_t
+present_numa_current(present_numa_t const * p_numa);
+
+/**
+ * @brief Gets the nodes of memory pages.
+ *
+ * The function finds the node of the page of every address of
+ * \a pp_addrs. The pages must be touched before, since the kernel has no
+ * node for a page without a frame.
+ *
+ * @param[in]  p_numa   Pointer of the topology.
+ * @param[in]  pp_addrs Pointer of the addresses.
+ * @param[out] p_nodes  Pointer of the node indexes. The entry of an
+ *                      address whose node is unknown is set to
+ *                      @ref PRESENT_NUMA_NODES_MAX.
+ * @param[in]  count    Count of the addresses.
+ *
+ * @return True if the nodes are found, false if the host does not tell
+ *         them. In that case, all the entries are unknown.
+ */
+bool
+present_numa_query(present_numa_t const * p_numa, \
+                   void const * const * pp_addrs, size_t * p_nodes, \
+                   size_t count);
+
+/**
+ * @brief Moves the pages of a buffer to the nodes.
+ *
+ * The function moves the pages of the buffer pointed by \a p_addr either
+ * in turn to every node, or in as many equal slices as the nodes, so that
+ * the slice i is on the node i. The pages must be touched before. The
+ * turns are as long as a normal page, so a reserved huge page ends up on a
+ * single node in turn mode.
+ *
+ * @param[in] p_numa     Pointer of the topology.
+ * @param[in] p_addr     Pointer of the buffer. It must be aligned to a page.
+ * @param[in] size       Size of the buffer in byte.
+ * @param[in] interleave True to spread the pages in turn, false to place
+ *                       them in slices.
+ *
+ * @return True if all the pages are moved, false otherwise.
+ */
+bool
+present_numa_place(present_numa_t const * p_numa, void * p_addr, \
+                   size_t size, bool interleave);
+
+/**
+ * @brief Allocates a buffer on huge pages.
+ *
+ * The function maps a buffer of at least \a size bytes on the pages of
+ * @ref PRESENT_NUMA_HUGE_PAGE bytes. If the host has no reserved huge
+ * page, the buffer is mapped on the normal pages, and the kernel is asked
+ * to merge them into transparent huge pages.
+ *
+ * @param[in]  size   Size of the buffer in byte.
+ * @param[out] p_huge Pointer of the flag that is set if the buffer is on
+ *                    the reserved huge pages. It could be NULL.
+ *
+ * @return Pointer of the buffer aligned to a page, or NULL if the memory
+ *         is out.
+ */
+void *
+present_numa_alloc(size_t size, bool * p_huge);
+
+/**
+ * @brief Frees a buffer of @ref present_numa_alloc.
+ *
+ * @param[in] p_addr Pointer of the buffer. It could be NULL.
+ * @param[in] size   Size of the buffer in byte, as given to the allocation.
+ *
+ * @return None.
+ */
+void
+present_numa_free(void * p_addr, size_t size);
+
+#endif  /* CONF_PRESENT_NUMA */
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_NUMA_H */
+
+/*** END OF FILE ***/
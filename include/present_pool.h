@@ -0,0 +1,256 @@
+/**
+ * @file present_pool.h
+ * @brief Header file of the PRESENT worker pool.
+ *
+ * The file is the C/C++ interface of the PRESENT worker pool. The file
+ * contains global symbol and function declarations, data structures, type
+ * definitions, etc, of the module.
+ *
+ * A pool owns a set of worker threads that split the large bulk calls
+ * into chunks of @ref PRESENT_POOL_CHUNK bytes. The calling thread takes
+ * chunks as well, and the call returns when all the chunks are done. The
+ * calls below the threshold of the pool run on the calling thread only.
+ *
+ * On the NUMA hosts, the chunks of a call are sorted by the node of their
+ * pages, and every thread takes the chunks of its own node first. The
+ * threads of a node only take the chunks of the other nodes when their
+ * own ones are done.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_POOL_H
+#define PRESENT_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+#if CONF_PRESENT_POOL
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <pthread.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+#include <present_ctr.h>
+#include <present_numa.h>
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT worker pool operation type.
+ *
+ * This type selects the operation of the running call of a pool.
+ */
+typedef enum {
+    /*! ECB encryption. */
+    PRESENT_POOL_ENCRYPT,
+    /*! ECB decryption. */
+    PRESENT_POOL_DECRYPT,
+    /*! Counter mode encryption or decryption. */
+    PRESENT_POOL_CTR
+} present_pool_op_t;
+
+/**
+ * @brief PRESENT worker pool type.
+ *
+ * This type holds the worker threads and the running call of a pool. It is
+ * initialized by @ref present_pool_init. The fields are only accessed by
+ * the pool functions.
+ */
+typedef struct {
+    /*! Worker threads. */
+    pthread_t             workers[PRESENT_POOL_THREADS_MAX];
+    /*! Count of the worker threads. */
+    size_t                worker_count;
+    /*! Size of the smallest call that is split in byte. */
+    size_t                threshold;
+    /*! Lock that serializes the calls. */
+    pthread_mutex_t       call_lock;
+    /*! Lock of the worker states. */
+    pthread_mutex_t       lock;
+    /*! Condition that wakes the workers up for a call or the stop. */
+    pthread_cond_t        wake;
+    /*! Condition that tells the end of the call to the caller. */
+    pthread_cond_t        done;
+    /*! Number of the last call. */
+    unsigned long         generation;
+    /*! Count of the workers that could still join the call. */
+    size_t                tickets;
+    /*! Count of the workers that run the call. */
+    size_t                running;
+    /*! True if the workers should exit. */
+    bool                  stop;
+    /*! Operation of the call. */
+    present_pool_op_t     op;
+    /*! Pointer of the crypt context of the call. */
+    present_ctx_t const * p_ctx;
+    /*! Pointer of the counter mode state at the first block of the call. */
+    present_ctr_t const * p_ctr;
+    /*! Pointer of the output buffer of the call. */
+    uint8_t *             p_dst;
+    /*! Pointer of the input buffer of the call. */
+    uint8_t const *       p_src;
+    /*! Count of the blocks of the call. */
+    size_t                count;
+    /*! Index of the first chunk of the round. */
+    size_t                base;
+    /*! Count of the chunks of the round. */
+    size_t                chunks;
+    /*! Chunks of the round from the base, sorted by their node. */
+    size_t                order[PRESENT_POOL_ROUND];
+    /*! Nodes of the chunks of the round. */
+    size_t                chunk_nodes[PRESENT_POOL_ROUND];
+    /*! First addresses of the chunks of the round. */
+    void const *          p_addrs[PRESENT_POOL_ROUND];
+    /*! Index of the first chunk of every node in \a order, and the count
+        of the chunks of the round. */
+    size_t                node_first[PRESENT_NUMA_NODES_MAX + 1u];
+    /*! Count of the taken chunks of every node. */
+    size_t                node_next[PRESENT_NUMA_NODES_MAX];
+    /*! NUMA topology of the host. */
+    present_numa_t        numa;
+} present_pool_t;
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Initializes the worker pool.
+ *
+ * The function starts the worker threads of the pool pointed by
+ * \a p_pool.
+ *
+ * @param[out] p_pool    Pointer of the pool.
+ * @param[in]  threads   Count of the threads that run a call, including the
+ *                       caller. Zero selects the count of the online CPUs.
+ *                       It is limited by @ref PRESENT_POOL_THREADS_MAX.
+ * @param[in]  threshold Size of the smallest call that is split across the
+ *                       threads in byte.
+ * @param[in]  affinity  True to bind every worker to a CPU of the affinity
+ *                       mask of the process. The workers take the CPUs of
+ *                       the mask in order from the second one, and wrap
+ *                       around it. It is ignored on the hosts other than
+ *                       Linux.
+ *
+ * @return True if the pool is started, false if a resource could not be
+ *         allocated or a worker could not be bound.
+ */
+bool
+present_pool_init(present_pool_t * p_pool, size_t threads, \
+                  size_t threshold, bool affinity);
+
+/**
+ * @brief Stops the worker pool.
+ *
+ * The function stops and joins the worker threads of the pool pointed by
+ * \a p_pool, and releases its resources.
+ *
+ * @warning No call of the pool may be running.
+ *
+ * @param[in,out] p_pool Pointer of the pool.
+ *
+ * @return None.
+ */
+void
+present_pool_destroy(present_pool_t * p_pool);
+
+/**
+ * @brief Encrypts consecutive text blocks by the pool.
+ *
+ * The function is the parallel version of @ref present_encrypt_blocks.
+ *
+ * @warning The buffers must either be the same or not overlap.
+ *
+ * @param[in,out] p_pool Pointer of the pool.
+ * @param[in]     p_ctx  Pointer of the crypt context.
+ * @param[out]    p_dst  Pointer of the crypted text buffer.
+ * @param[in]     p_src  Pointer of the raw text buffer.
+ * @param[in]     count  Count of the blocks.
+ *
+ * @return None.
+ */
+void
+present_pool_encrypt_blocks(present_pool_t * p_pool, \
+                            present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks by the pool.
+ *
+ * The function is the parallel version of @ref present_decrypt_blocks.
+ *
+ * @warning The buffers must either be the same or not overlap.
+ *
+ * @param[in,out] p_pool Pointer of the pool.
+ * @param[in]     p_ctx  Pointer of the crypt context.
+ * @param[out]    p_dst  Pointer of the raw text buffer.
+ * @param[in]     p_src  Pointer of the crypted text buffer.
+ * @param[in]     count  Count of the blocks.
+ *
+ * @return None.
+ */
+void
+present_pool_decrypt_blocks(present_pool_t * p_pool, \
+                            present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Encrypts or decrypts a buffer in counter mode by the pool.
+ *
+ * The function is the parallel version of @ref present_ctr_crypt. Every
+ * chunk starts its own counter at the block offset of the chunk, and the
+ * state pointed by \a p_ctr is advanced past the buffer at the end.
+ *
+ * @warning The buffers must either be the same or not overlap.
+ *
+ * @param[in,out] p_pool Pointer of the pool.
+ * @param[in,out] p_ctr  Pointer of the counter mode state.
+ * @param[out]    p_dst  Pointer of the output buffer.
+ * @param[in]     p_src  Pointer of the input buffer.
+ * @param[in]     size   Size of the buffers in byte.
+ *
+ * @return True if the buffer is processed, false if it passes the counter
+ *         space. In that case, nothing is processed.
+ */
+bool
+present_pool_ctr_crypt(present_pool_t * p_pool, present_ctr_t * p_ctr, \
+                       uint8_t * p_dst, uint8_t const * p_src, size_t size);
+
+#endif  /* CONF_PRESENT_POOL */
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_POOL_H */
+
+/*** END OF FILE ***/
@@ -0,0 +1,309 @@
+/**
+ * @file present_sched.h
+ * @brief Header file of the PRESENT work-stealing scheduler.
+ *
+ * The file is the C/C++ interface of the PRESENT work-stealing scheduler.
+ * The file contains global symbol and function declarations, data
+ * structures, type definitions, etc, of the module.
+ *
+ * Every worker of a scheduler owns a deque of jobs. A worker takes the
+ * newest job of its own deque, and when its deque runs dry, it steals the
+ * oldest job of another worker. So, the workers stay busy while the jobs
+ * of a batch have very different sizes. A job is a whole message in one of
+ * the modes of the project, processed with the context API.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_SCHED_H
+#define PRESENT_SCHED_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+#if CONF_PRESENT_SCHED
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <pthread.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT scheduler operation type.
+ *
+ * This type selects the operation of a job.
+ */
+typedef enum {
+    /*! ECB encryption. */
+    PRESENT_SCHED_ECB_ENCRYPT,
+    /*! ECB decryption. */
+    PRESENT_SCHED_ECB_DECRYPT,
+    /*! CBC encryption. */
+    PRESENT_SCHED_CBC_ENCRYPT,
+    /*! CBC decryption. */
+    PRESENT_SCHED_CBC_DECRYPT,
+    /*! Counter mode encryption or decryption. */
+    PRESENT_SCHED_CTR
+} present_sched_op_t;
+
+/**
+ * @brief PRESENT scheduler job type.
+ *
+ * This type describes a message to process. The caller fills the fields
+ * up to \a p_user; the scheduler fills the rest.
+ */
+typedef struct {
+    /*! Operation of the job. */
+    present_sched_op_t    op;
+    /*! Pointer of the crypt context. */
+    present_ctx_t const * p_ctx;
+    /*! Pointer of the output buffer. */
+    uint8_t *             p_dst;
+    /*! Pointer of the input buffer. */
+    uint8_t const *       p_src;
+    /*! Size of the message in byte. It must be a multiple of the block
+        size in ECB and CBC modes. */
+    size_t                size;
+    /*! Initialization vector of the CBC mode, or the initial counter block
+        of the counter mode. */
+    uint8_t               iv[PRESENT_CRYPT_SIZE];
+    /*! Bit count of the counter part of the counter mode. */
+    uint8_t               counter_bits;
+    /*! Pointer of the user data. The scheduler does not access it. */
+    void *                p_user;
+    /*! Submission time of the job in nanosecond. */
+    uint64_t              submit_ns;
+    /*! Start time of the job in nanosecond. */
+    uint64_t              start_ns;
+    /*! Completion time of the job in nanosecond. */
+    uint64_t              done_ns;
+    /*! True if the job is valid and processed. */
+    bool                  ok;
+    /*! Nonzero when the job is done. */
+    unsigned char         done;
+} present_sched_job_t;
+
+/**
+ * @brief PRESENT scheduler worker type.
+ *
+ * This type holds the deque and the counters of a worker. The fields are
+ * only accessed by the scheduler functions.
+ */
+typedef struct {
+    /*! Pointer of the scheduler of the worker. */
+    void *                p_sched;
+    /*! Thread of the worker. */
+    pthread_t             thread;
+    /*! Jobs of the deque, as a ring. */
+    present_sched_job_t * p_jobs[PRESENT_SCHED_DEQUE];
+    /*! Index of the oldest job. Thieves take the jobs from here. */
+    size_t                top;
+    /*! Index after the newest job. The owner takes the jobs from here. */
+    size_t                bottom;
+    /*! Spin lock of the deque. */
+    unsigned char         lock;
+    /*! State of the victim selection. */
+    uint32_t              seed;
+    /*! Count of the jobs run by the worker. */
+    unsigned long         executed;
+    /*! Count of the jobs stolen by the worker. */
+    unsigned long         stolen;
+    /*! Time spent on the jobs in nanosecond. */
+    uint64_t              busy_ns;
+} present_sched_worker_t;
+
+/**
+ * @brief PRESENT work-stealing scheduler type.
+ *
+ * This type holds the workers of a scheduler. It is initialized by
+ * @ref present_sched_init. The fields are only accessed by the scheduler
+ * functions.
+ */
+typedef struct {
+    /*! Workers of the scheduler. */
+    present_sched_worker_t workers[PRESENT_SCHED_THREADS_MAX];
+    /*! Count of the workers. */
+    size_t                 worker_count;
+    /*! Worker that takes the next submitted batch. */
+    size_t                 next;
+    /*! Count of the queued jobs that no worker has taken yet. */
+    size_t                 queued;
+    /*! Count of the submitted jobs. */
+    unsigned long          submitted;
+    /*! Count of the done jobs. */
+    unsigned long          completed;
+    /*! Lock of the sleep and the wait conditions. */
+    pthread_mutex_t        lock;
+    /*! Condition that wakes the idle workers up. */
+    pthread_cond_t         wake;
+    /*! Condition that tells the waiting callers that all jobs are done. */
+    pthread_cond_t         idle;
+    /*! True if the workers should exit. */
+    bool                   stop;
+    /*! Start time of the scheduler in nanosecond. */
+    uint64_t               start_ns;
+} present_sched_t;
+
+/**
+ * @brief PRESENT scheduler statistics type.
+ *
+ * This type holds the counters of a scheduler, summed over the workers.
+ */
+typedef struct {
+    /*! Count of the submitted jobs. */
+    unsigned long submitted;
+    /*! Count of the done jobs. */
+    unsigned long completed;
+    /*! Count of the jobs taken from another worker. */
+    unsigned long stolen;
+    /*! Time spent on the jobs by all workers in nanosecond. */
+    uint64_t      busy_ns;
+    /*! Time since the start of the scheduler multiplied by the worker
+        count in nanosecond. The ratio of \a busy_ns to it is the
+        utilization of the workers. */
+    uint64_t      capacity_ns;
+} present_sched_stats_t;
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Initializes the scheduler.
+ *
+ * The function starts the workers of the scheduler pointed by \a p_sched.
+ *
+ * @param[out] p_sched Pointer of the scheduler.
+ * @param[in]  threads Count of the workers. Zero selects the count of the
+ *                     online CPUs. It is limited by
+ *                     @ref PRESENT_SCHED_THREADS_MAX.
+ *
+ * @return True if the scheduler is started, false if a resource could not
+ *         be allocated.
+ */
+bool
+present_sched_init(present_sched_t * p_sched, size_t threads);
+
+/**
+ * @brief Stops the scheduler.
+ *
+ * The function waits for the submitted jobs, stops and joins the workers
+ * of the scheduler pointed by \a p_sched and releases its resources.
+ *
+ * @param[in,out] p_sched Pointer of the scheduler.
+ *
+ * @return None.
+ */
+void
+present_sched_destroy(present_sched_t * p_sched);
+
+/**
+ * @brief Submits a batch of jobs.
+ *
+ * The function queues the jobs pointed by the \a count entries of
+ * \a pp_jobs. The batch is spread over the deques of the workers, and the
+ * idle workers are woken up. A job must stay valid until it is done.
+ *
+ * @param[in,out] p_sched Pointer of the scheduler.
+ * @param[in,out] pp_jobs Pointer of the jobs.
+ * @param[in]     count   Count of the jobs.
+ *
+ * @return Count of the queued jobs from the beginning of the batch. It is
+ *         less than \a count if the deques are full.
+ */
+size_t
+present_sched_submit(present_sched_t * p_sched, \
+                     present_sched_job_t * const * pp_jobs, size_t count);
+
+/**
+ * @brief Waits for the submitted jobs.
+ *
+ * The function blocks until all the jobs that are submitted to the
+ * scheduler pointed by \a p_sched are done.
+ *
+ * @param[in,out] p_sched Pointer of the scheduler.
+ *
+ * @return None.
+ */
+void
+present_sched_wait(present_sched_t * p_sched);
+
+/**
+ * @brief Gets the statistics of the scheduler.
+ *
+ * @param[in]  p_sched Pointer of the scheduler.
+ * @param[out] p_stats Pointer of the statistics.
+ *
+ * @return None.
+ */
+void
+present_sched_stats(present_sched_t * p_sched, \
+                    present_sched_stats_t * p_stats);
+
+/**
+ * @brief Processes a whole message.
+ *
+ * The function runs the operation of a job on the calling thread. It is
+ * the body of the jobs of the scheduler, and it is shared by the other
+ * job based modules.
+ *
+ * @param[in]     op           Operation of the message.
+ * @param[in]     p_ctx        Pointer of the crypt context.
+ * @param[in,out] p_iv         Pointer of the initialization vector or the
+ *                             initial counter block. The CBC modes update
+ *                             it like @ref present_cbc_encrypt.
+ * @param[in]     counter_bits Bit count of the counter part of the counter
+ *                             mode.
+ * @param[out]    p_dst        Pointer of the output buffer.
+ * @param[in]     p_src        Pointer of the input buffer.
+ * @param[in]     size         Size of the message in byte.
+ *
+ * @return True if the message is processed, false if the size is not a
+ *         multiple of the block size in ECB and CBC modes, or the counter
+ *         bit count is out of range, or the message passes the counter
+ *         space.
+ */
+bool
+present_sched_crypt(present_sched_op_t op, present_ctx_t const * p_ctx, \
+                    uint8_t * p_iv, uint8_t counter_bits, uint8_t * p_dst, \
+                    uint8_t const * p_src, size_t size);
+
+#endif  /* CONF_PRESENT_SCHED */
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_SCHED_H */
+
+/*** END OF FILE ***/
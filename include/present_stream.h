@@ -0,0 +1,167 @@
+/**
+ * @file present_stream.h
+ * @brief Header file of the PRESENT streaming interface.
+ *
+ * The file is the C/C++ interface of the PRESENT streaming interface. The
+ * file contains global symbol and function declarations, data structures,
+ * type definitions, etc, of the module.
+ *
+ * A message is processed by an init call, any count of update calls with
+ * parts of any size, and a final call. Only the partial block between the
+ * parts is buffered; the full blocks of a part are processed from the
+ * input buffer to the output buffer directly. The final call optionally
+ * adds or removes the PKCS#7 padding.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#ifndef PRESENT_STREAM_H
+#define PRESENT_STREAM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif  /* __cplusplus */
+
+#include <conf.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present.h>
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief PRESENT streaming mode type.
+ *
+ * This type selects the block cipher mode of a stream.
+ */
+typedef enum {
+    /*! Electronic codebook mode. */
+    PRESENT_STREAM_ECB,
+    /*! Cipher block chaining mode. */
+    PRESENT_STREAM_CBC
+} present_stream_mode_t;
+
+/**
+ * @brief PRESENT stream state type.
+ *
+ * This type holds the state of a message between the update calls. It is
+ * initialized by @ref present_stream_init.
+ */
+typedef struct {
+    /*! Pointer of the crypt context. */
+    present_ctx_t const * p_ctx;
+    /*! Block cipher mode of the stream. */
+    present_stream_mode_t mode;
+    /*! True if the stream encrypts, false if it decrypts. */
+    bool                  encrypt;
+    /*! True if the final call handles the PKCS#7 padding. */
+    bool                  padding;
+    /*! Chain block of the CBC mode. */
+    uint8_t               chain[PRESENT_CRYPT_SIZE];
+    /*! Buffered bytes of the last partial block. */
+    uint8_t               buffer[PRESENT_CRYPT_SIZE];
+    /*! Count of the buffered bytes. */
+    uint8_t               buffered;
+} present_stream_t;
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Initializes the stream state.
+ *
+ * The function prepares the state pointed by \a p_stream for a message.
+ *
+ * @warning The context pointed by \a p_ctx must stay valid while the state
+ *          is used.
+ *
+ * @param[out] p_stream Pointer of the stream state.
+ * @param[in]  p_ctx    Pointer of the crypt context.
+ * @param[in]  mode     Block cipher mode of the stream.
+ * @param[in]  encrypt  True to encrypt, false to decrypt.
+ * @param[in]  padding  True to add the padding at the encryption and to
+ *                      remove it at the decryption.
+ * @param[in]  p_iv     Pointer of the initialization vector with length of
+ *                      @ref PRESENT_CRYPT_SIZE. It is only used in CBC
+ *                      mode and could be NULL in ECB mode.
+ *
+ * @return None.
+ */
+void
+present_stream_init(present_stream_t * p_stream, present_ctx_t const * p_ctx, \
+                    present_stream_mode_t mode, bool encrypt, bool padding, \
+                    uint8_t const * p_iv);
+
+/**
+ * @brief Processes a message part.
+ *
+ * The function processes \a size bytes of the buffer pointed by \a p_src
+ * and writes the full blocks to the buffer pointed by \a p_dst. The rest
+ * of the part is buffered for the next call. A decrypting stream with
+ * padding keeps the last full block for @ref present_stream_final.
+ *
+ * @warning The buffer pointed by \a p_dst must have room for \a size plus
+ *          @ref PRESENT_CRYPT_SIZE bytes. The buffers must not overlap.
+ *
+ * @param[in,out] p_stream Pointer of the stream state.
+ * @param[out]    p_dst    Pointer of the output buffer.
+ * @param[in]     p_src    Pointer of the input buffer.
+ * @param[in]     size     Size of the input buffer in byte.
+ *
+ * @return Count of the bytes written to the output buffer.
+ */
+size_t
+present_stream_update(present_stream_t * p_stream, uint8_t * p_dst, \
+                      uint8_t const * p_src, size_t size);
+
+/**
+ * @brief Finishes the message.
+ *
+ * The function processes the buffered bytes of the message and writes the
+ * result to the buffer pointed by \a p_dst. An encrypting stream with
+ * padding writes a full padding block; a decrypting stream with padding
+ * writes the last block without its padding.
+ *
+ * @warning The buffer pointed by \a p_dst must have room for
+ *          @ref PRESENT_CRYPT_SIZE bytes.
+ *
+ * @param[in,out] p_stream Pointer of the stream state.
+ * @param[out]    p_dst    Pointer of the output buffer.
+ * @param[out]    p_size   Pointer of the count of the written bytes.
+ *
+ * @return True if the message is finished, false if the message is not a
+ *         whole count of blocks or its padding is not valid.
+ */
+bool
+present_stream_final(present_stream_t * p_stream, uint8_t * p_dst, \
+                     size_t * p_size);
+
+#ifdef __cplusplus
+}
+#endif  /* __cplusplus */
+
+#endif  /* PRESENT_STREAM_H */
+
+/*** END OF FILE ***/
@@ -0,0 +1,212 @@
+/**
+ * @file cpu.c
+ * @brief Source file of the CPU feature module.
+ *
+ * The file is the C implementation of the CPU feature module. The file
+ * contains global and static function definitions, data structures, type
+ * definitions, etc, of the module.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+/*
+ * Required for the scheduler functions of POSIX.
+ */
+#if !defined(_POSIX_C_SOURCE)
+#   define _POSIX_C_SOURCE 200809L
+#endif  /* _POSIX_C_SOURCE */
+
+#include <cpu.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_CPU)
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#if CPU_USE_X86
+#   include <cpuid.h>
+#endif  /* CPU_USE_X86 */
+
+#if defined(__unix__)
+#   include <unistd.h>
+#endif  /* __unix__ */
+
+#if defined(_POSIX_PRIORITY_SCHEDULING)
+#   include <sched.h>
+#endif  /* _POSIX_PRIORITY_SCHEDULING */
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * SSSE3 flag in the ECX register of the CPUID leaf 1.
+ */
+#define CPU_CPUID1_ECX_SSSE3   (BIT(9u))
+
+/*
+ * OSXSAVE flag in the ECX register of the CPUID leaf 1.
+ */
+#define CPU_CPUID1_ECX_OSXSAVE (BIT(27u))
+
+/*
+ * AVX flag in the ECX register of the CPUID leaf 1.
+ */
+#define CPU_CPUID1_ECX_AVX     (BIT(28u))
+
+/*
+ * AVX2 flag in the EBX register of the CPUID leaf 7.
+ */
+#define CPU_CPUID7_EBX_AVX2    (BIT(5u))
+
+/*
+ * SSE and AVX state flags of the XCR0 register.
+ */
+#define CPU_XCR0_SSE_AVX       (BIT(1u) | BIT(2u))
+
+/*
+ * Flag that marks the cached features as probed. It is never reported to
+ * the caller.
+ */
+#define CPU_FEATURE_PROBED     (BIT(31u))
+
+/*****************************************************************************/
+/* GLOBAL VARIABLES                                                          */
+/*****************************************************************************/
+
+#if CPU_USE_X86
+/**
+ * Features of the host CPU. The CPU is only probed by the first call.
+ */
+static unsigned int g_cpu_features = 0u;
+#endif  /* CPU_USE_X86 */
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Probes the features of the host CPU.
+ *
+ * The function runs the CPUID instruction and returns the supported
+ * features as a combination of the CPU_FEATURE flags.
+ *
+ * @return The feature flags.
+ */
+static unsigned int
+cpu_probe_features(void);
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+unsigned int
+cpu_get_features (void)
+{
+#if CPU_USE_X86
+    unsigned int features = __atomic_load_n(&g_cpu_features, \
+                                            __ATOMIC_RELAXED);
+
+    /*
+     * Every probe gives the same result. So, concurrent first calls could
+     * only store the same value.
+     */
+    if (0u == (features & CPU_FEATURE_PROBED))
+    {
+        features = cpu_probe_features() | CPU_FEATURE_PROBED;
+        __atomic_store_n(&g_cpu_features, features, __ATOMIC_RELAXED);
+    }
+
+    return features & ~CPU_FEATURE_PROBED;
+#else
+    /*
+     * The other targets have no feature to probe.
+     */
+    return cpu_probe_features();
+#endif  /* CPU_USE_X86 */
+}  /* cpu_get_features() */
+
+void
+cpu_spin (unsigned int * p_spins)
+{
+    if (*p_spins < CPU_SPIN_PAUSES)
+    {
+        (*p_spins)++;
+#if CPU_USE_X86
+        __builtin_ia32_pause();
+#endif  /* CPU_USE_X86 */
+        return;
+    }
+
+#if defined(_POSIX_PRIORITY_SCHEDULING)
+    (void)sched_yield();
+#endif  /* _POSIX_PRIORITY_SCHEDULING */
+}  /* cpu_spin() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static unsigned int
+cpu_probe_features (void)
+{
+    unsigned int features = 0u;
+
+#if CPU_USE_X86
+    unsigned int eax;
+    unsigned int ebx;
+    unsigned int ecx;
+    unsigned int edx;
+    unsigned int xcr0;
+
+    if (!__get_cpuid(1u, &eax, &ebx, &ecx, &edx))
+    {
+        return features;
+    }
+
+    if (ecx & CPU_CPUID1_ECX_SSSE3)
+    {
+        features |= CPU_FEATURE_SSSE3;
+    }
+
+    /*
+     * AVX registers could only be used if the operating system saves them
+     * during the context switches.
+     */
+    if ((ecx & CPU_CPUID1_ECX_OSXSAVE) && (ecx & CPU_CPUID1_ECX_AVX))
+    {
+        __asm__ __volatile__ ("xgetbv" : "=a" (xcr0), "=d" (edx) : "c" (0u));
+
+        if (((xcr0 & CPU_XCR0_SSE_AVX) == CPU_XCR0_SSE_AVX)
+            && __get_cpuid_count(7u, 0u, &eax, &ebx, &ecx, &edx)
+            && (ebx & CPU_CPUID7_EBX_AVX2))
+        {
+            features |= CPU_FEATURE_AVX2;
+        }
+    }
+#endif  /* CPU_USE_X86 */
+
+    return features;
+}  /* cpu_probe_features() */
+
+/*** END OF FILE ***/
@@ -44,6 +44,7 @@
 /* STANDART C LIBRARIES                                                      */
 /*****************************************************************************/
 
+#include <stdlib.h>
 #include <string.h>
 
 /*****************************************************************************/
@@ -51,90 +52,36 @@
 /*****************************************************************************/
 
 #include <assert.h>
+#include <present_engine.h>
 
 /*****************************************************************************/
 /* STATIC SYMBOL DEFINITIONS                                                 */
 /*****************************************************************************/
 
-/*
- * Start point offset of the key part that used in the crypt process.
- */
-#define PRESENT_KEY_OFFSET (PRESENT_KEY_SIZE - PRESENT_CRYPT_SIZE)
-
-/*
- * Shift count for each side in bits.
- */
-#define PRESENT_SHIFT_COUNT (61u)
-
-/*
- * Key size in 16-bit blocks.
- */
-#define PRESENT_KEY_BLOCK_SIZE (PRESENT_KEY_BIT_SIZE / 16u)
-
 /*
  * Buffer size that holds the new values during the permutation stage.
  */
 #define PRESENT_PERMUTATION_BUFF_SIZE (PRESENT_CRYPT_BIT_SIZE / 16u)
 
 /*
- * Buffer size that holds the rotated blocks during left shift.
- */
-#if PRESENT_USE_KEY80
-#   define PRESENT_ROTATE_BUFF_SIZE_LEFT (2u)
-#elif PRESENT_USE_KEY128
-#   define PRESENT_ROTATE_BUFF_SIZE_LEFT (5u)
-#endif  /* PRESENT_USE_KEY128 */
-
-/*
- * Buffer size that holds the rotated blocks during right shift.
- */
-#define PRESENT_ROTATE_BUFF_SIZE_RIGHT (4u)
-
-/*
- * The point where LSB and MSB came side to side after rotation to left.
+ * Mask of the 16 most significant bits of the 80-bit key register.
  */
-#define PRESENT_ROTATION_POINT_LEFT (3u)
+#define PRESENT_KEY80_HIGH_MASK (0xFFFFu)
 
 /*
- * The point where LSB and MSB came side to side after rotation to right.
+ * Loads and stores of the bound engine. Without the GCC atomic builtins,
+ * the engine is a plain pointer, so the engine must be selected before
+ * the threads are started.
  */
-#if PRESENT_USE_KEY80
-#   define PRESENT_ROTATION_POINT_RIGHT (1u)
-#elif PRESENT_USE_KEY128
-#   define PRESENT_ROTATION_POINT_RIGHT (4u)
-#endif  /* PRESENT_USE_KEY128 */
-
-/*
- * Block count to be shifted after the rotation point during left shift.
- */
-#if PRESENT_USE_KEY80
-#   define PRESENT_UNROTATED_BLOCK_COUNT_LEFT (1u)
-#elif PRESENT_USE_KEY128
-#   define PRESENT_UNROTATED_BLOCK_COUNT_LEFT (4u)
-#endif  /* PRESENT_USE_KEY128 */
-
-/*
- * Block count to be shifted after the rotation point during right shift.
- */
-#define PRESENT_UNROTATED_BLOCK_COUNT_RIGHT (3u)
-
-/*
- * Offset value of the LSB bits source block during left shift.
- */
-#if PRESENT_USE_KEY80
-#   define PRESENT_ROTATION_LSB_OFFSET (2u)
-#elif PRESENT_USE_KEY128
-#   define PRESENT_ROTATION_LSB_OFFSET (5u)
-#endif  /* PRESENT_USE_KEY128 */
-
-/*
- * Offset value of the MSB bits source block during left shift.
- */
-#if PRESENT_USE_KEY80
-#   define PRESENT_ROTATION_MSB_OFFSET (1u)
-#elif PRESENT_USE_KEY128
-#   define PRESENT_ROTATION_MSB_OFFSET (4u)
-#endif  /* PRESENT_USE_KEY128 */
+#if defined(__GNUC__)
+#   define PRESENT_ENGINE_LOAD()                                             \
+        (__atomic_load_n(&gp_engine, __ATOMIC_ACQUIRE))
+#   define PRESENT_ENGINE_STORE(p_engine)                                    \
+        (__atomic_store_n(&gp_engine, (p_engine), __ATOMIC_RELEASE))
+#else
+#   define PRESENT_ENGINE_LOAD()          (gp_engine)
+#   define PRESENT_ENGINE_STORE(p_engine) (gp_engine = (p_engine))
+#endif  /* __GNUC__ */
 
 /*****************************************************************************/
 /* COMPILE-TIME ERROR CHECKS                                                 */
@@ -145,11 +92,11 @@
 #endif
 
 #if (!PRESENT_USE_KEY80 && !PRESENT_USE_KEY128)
-#   error "Key size must be configured!"
+#   error "Default key size must be configured!"
 #endif
 
 #if (PRESENT_USE_KEY80 && PRESENT_USE_KEY128)
-#   error "Only one key size can be chosen!"
+#   error "Only one default key size can be chosen!"
 #endif
 
 #if (PRESENT_ROUND_COUNT < PRESENT_ROUND_COUNT_MIN)
@@ -166,7 +113,7 @@
 
 /**
  * This type is used in functions @ref present_substitution and
- * @ref present_update_key to describe which process is runnig.
+ * @ref present_permutation to describe which process is runnig.
  */
 typedef enum {
     /*! Specifies the encryption operation. */
@@ -182,41 +129,198 @@ typedef enum {
 /**
  * Lookup table for PRESENT substitution process.
  */
-static uint8_t const g_sbox[] = {0x0Cu, 0x05u, 0x06u, 0x0Bu, \
-                                 0x09u, 0x00u, 0x0Au, 0x0Du, \
-                                 0x03u, 0x0Eu, 0x0Fu, 0x08u, \
-                                 0x04u, 0x07u, 0x01u, 0x02u};
+uint8_t const g_sbox[16] = {0x0Cu, 0x05u, 0x06u, 0x0Bu, \
+                            0x09u, 0x00u, 0x0Au, 0x0Du, \
+                            0x03u, 0x0Eu, 0x0Fu, 0x08u, \
+                            0x04u, 0x07u, 0x01u, 0x02u};
 
 /**
  * Lookup table for PRESENT inverse substitution process.
  */
-static uint8_t const g_sbox_inv[] = {0x05u, 0x0Eu, 0x0Fu, 0x08u, \
-                                     0x0Cu, 0x01u, 0x02u, 0x0Du, \
-                                     0x0Bu, 0x04u, 0x06u, 0x03u, \
-                                     0x00u, 0x07u, 0x09u, 0x0Au};
+uint8_t const g_sbox_inv[16] = {0x05u, 0x0Eu, 0x0Fu, 0x08u, \
+                                0x0Cu, 0x01u, 0x02u, 0x0Du, \
+                                0x0Bu, 0x04u, 0x06u, 0x03u, \
+                                0x00u, 0x07u, 0x09u, 0x0Au};
+
+/**
+ * Engines of the module in the order of @ref present_engine_id_t.
+ */
+static present_engine_t const * const g_engines[PRESENT_ENGINE_COUNT] = {
+    &g_present_engine_ref,
+    &g_present_engine_word,
+    &g_present_engine_table,
+    &g_present_engine_bitslice,
+#if CPU_USE_X86
+    &g_present_engine_ssse3,
+    &g_present_engine_avx2
+#else
+    NULL,
+    NULL
+#endif  /* CPU_USE_X86 */
+};
+
+/**
+ * Engines that are tried by the automatic selection, from the fastest one.
+ * The bitsliced engine runs its remaining blocks on the SSSE3 engine, so it
+ * is ahead of it. The table engine runs on every CPU, so the list always
+ * ends with it.
+ */
+static present_engine_id_t const g_engine_order[] = {
+    PRESENT_ENGINE_AVX2,
+    PRESENT_ENGINE_BITSLICE,
+    PRESENT_ENGINE_SSSE3,
+    PRESENT_ENGINE_TABLE
+};
+
+/**
+ * Engine that is bound to the crypt functions, or NULL until an engine is
+ * selected. It is only accessed by @ref PRESENT_ENGINE_LOAD and
+ * @ref PRESENT_ENGINE_STORE, since the crypt functions of many threads
+ * could make the automatic selection at the same time.
+ */
+static present_engine_t const * gp_engine = NULL;
 
 /*****************************************************************************/
 /* STATIC FUNCTION PROTOTYPES                                                */
 /*****************************************************************************/
 
+/**
+ * @brief Checks whether the engine could run on the host CPU.
+ *
+ * The function checks that the engine given by \p engine exists in the
+ * build and the host CPU supports all the features of the engine.
+ *
+ * @param[in] engine The engine ID.
+ *
+ * @return True if the engine is supported, false otherwise.
+ */
+static bool
+present_is_engine_supported(present_engine_id_t engine);
+
+/**
+ * @brief Gets the engine that is bound to the crypt functions.
+ *
+ * The function loads the bound engine. If no engine was selected yet, the
+ * engine is selected automatically first. Concurrent first calls select
+ * the same engine, so every caller gets a complete engine.
+ *
+ * @return Pointer of the engine.
+ */
+static present_engine_t const *
+present_active_engine(void);
+
+/**
+ * @brief Runs a multi-key crypt operation.
+ *
+ * The function checks the round counts of the contexts and passes the
+ * blocks to the multi-key function \p multi of the active engine. If the
+ * engine has no multi-key function, every block is passed to \p blocks
+ * with its own context.
+ *
+ * @param[in]  multi  Multi-key function of the active engine.
+ * @param[in]  blocks Multi-block function of the active engine.
+ * @param[in]  pp_ctx Pointer of the crypt contexts of the blocks.
+ * @param[out] p_dst  Pointer of the output buffer.
+ * @param[in]  p_src  Pointer of the input buffer.
+ * @param[in]  count  Count of the blocks.
+ *
+ * @return True if the blocks are processed, false if the contexts have
+ *         different round counts.
+ */
+static bool
+present_multi_crypt(present_multi_fn_t multi, present_blocks_fn_t blocks, \
+                    present_ctx_t const * const * pp_ctx, uint8_t * p_dst, \
+                    uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Encrypts consecutive text blocks with the reference engine.
+ *
+ * The function is the multi-block encryption function of the reference
+ * engine. It processes the blocks byte by byte as described in the
+ * article.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the crypted text buffer.
+ * @param[in]  p_src Pointer of the raw text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_ref_encrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                           uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with the reference engine.
+ *
+ * The function is the multi-block decryption function of the reference
+ * engine. It processes the blocks byte by byte as described in the
+ * article.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the raw text buffer.
+ * @param[in]  p_src Pointer of the crypted text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_ref_decrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                           uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Encrypts one text block with the key schedule.
+ *
+ * The function runs all the rounds of the encryption process on \p p_text
+ * with the round keys of \p p_ctx. For further information about the
+ * encryption process, see article's section 3.
+ *
+ * @warning The function assumes parameter \a p_text points a memory block
+ *          with length of @ref PRESENT_CRYPT_SIZE.
+ *
+ * @param[in] p_ctx  Pointer of the crypt context.
+ * @param[in] p_text Pointer of the text block.
+ *
+ * @return None.
+ */
+static void
+present_encrypt_block(present_ctx_t const * p_ctx, uint8_t * p_text);
+
+/**
+ * @brief Decrypts one text block with the key schedule.
+ *
+ * The function runs all the rounds of the decryption process on \p p_text
+ * with the round keys of \p p_ctx in reverse order. For further
+ * information about the decryption process, see article's section 3.
+ *
+ * @warning The function assumes parameter \a p_text points a memory block
+ *          with length of @ref PRESENT_CRYPT_SIZE.
+ *
+ * @param[in] p_ctx  Pointer of the crypt context.
+ * @param[in] p_text Pointer of the text block.
+ *
+ * @return None.
+ */
+static void
+present_decrypt_block(present_ctx_t const * p_ctx, uint8_t * p_text);
+
 /**
  * @brief Add key layer of the algorithm.
  *
- * The function adjust \p p_key and adds it to \p p_text. Add key operation
- * is simply an XOR operation of \p p_text and \p p_key. For further
+ * The function adds \p round_key to \p p_text. Add key operation is
+ * simply an XOR operation of \p p_text and \p round_key. For further
  * information about the PRESENT add key layer, see article's section 3.
  *
  * @warning The function assumes parameter \a p_text points a memory block
- *          with length of @ref PRESENT_CRYPT_SIZE and parameter \a p_key
- *          points a memory block with length of @ref PRESENT_KEY_SIZE.
+ *          with length of @ref PRESENT_CRYPT_SIZE.
  *
- * @param[in] p_text Pointer of the text block.
- * @param[in] p_key  Pointer of the crypt key.
+ * @param[in] p_text    Pointer of the text block.
+ * @param[in] round_key The round key.
  *
  * @return None.
  */
 static void
-present_add_key(uint8_t * p_text, uint8_t const * p_key);
+present_add_key(uint8_t * p_text, uint64_t round_key);
 
 /**
  * @brief Substitution layer of the algorithm.
@@ -290,214 +394,562 @@ static void
 present_decrypt_permutation(uint8_t * p_text);
 
 /**
- * @brief Update key layer of the algorithm.
+ * @brief Key schedule of the 80-bit keys.
  *
- * The function decides the operation order of the update key process.
- * Operation oder is chosen with respect to \p op. For further information
- * about the update key layer, see article's section 3.
- *
- * @warning The function assumes parameter \a p_key points a memory block
- *          with length of @ref PRESENT_KEY_SIZE.
- *
- * @param[in] p_key         Pointer of the crypt key.
- * @param[in] round_counter Index of the algorithm loop.
- * @param[in] op            The operation type.
- *
- * @return None.
- */
-static void
-present_update_key(uint8_t * p_key, uint8_t round_counter, present_op_t op);
-
-/**
- * @brief Update key step of the encryption operation.
- *
- * The function rotates \p p_key to the left 61-bit, substitutes the MSB
- * nibbles of the new value and XOR's related bits with \p round_counter.
- * For further information about the update key layer, see article's
+ * The function generates all the round keys of the 80-bit key pointed by
+ * \p p_key. The key register is kept in a 64-bit and a 16-bit word, so
+ * that the rotation and the counter addition are a few word operations.
+ * For further information about the key schedule, see article's
  * section 3.
  *
  * @warning The function assumes parameter \a p_key points a memory block
- *          with length of @ref PRESENT_KEY_SIZE.
+ *          with length of @ref PRESENT_KEY80_SIZE.
  *
- * @param[in] p_key         Pointer of the crypt key.
- * @param[in] round_counter Index of the algorithm loop.
+ * @param[out] p_ctx Pointer of the crypt context.
+ * @param[in]  p_key Pointer of the crypt key.
  *
  * @return None.
  */
 static void
-present_update_encrypt_key(uint8_t * p_key, uint8_t round_counter);
+present_key_schedule80(present_ctx_t * p_ctx, uint8_t const * p_key);
 
 /**
- * @brief Update key step of the decryption operation.
+ * @brief Key schedule of the 128-bit keys.
  *
- * The function XOR's related bits of \p p_key with \p round_counter,
- * substitutes the MSB nibbles of the new value and rotates to the right
- * 61-bit. For further information about the update key layer, see article's
- * section 3.
+ * The function generates all the round keys of the 128-bit key pointed by
+ * \p p_key. The key register is kept in two 64-bit words. For further
+ * information about the key schedule, see article's appendix II.
  *
  * @warning The function assumes parameter \a p_key points a memory block
- *          with length of @ref PRESENT_KEY_SIZE.
+ *          with length of @ref PRESENT_KEY128_SIZE.
  *
- * @param[in] p_key         Pointer of the crypt key.
- * @param[in] round_counter Index of the algorithm loop.
+ * @param[out] p_ctx Pointer of the crypt context.
+ * @param[in]  p_key Pointer of the crypt key.
  *
  * @return None.
  */
 static void
-present_update_decrypt_key(uint8_t * p_key, uint8_t round_counter);
+present_key_schedule128(present_ctx_t * p_ctx, uint8_t const * p_key);
 
-/**
- * @brief Generates the decryption key.
- *
- * The function generates the decryption key from the encryption key.
- * The decryption key is the value of the encryption key at the last round.
- *
- * @warning The function assumes parameter \a p_key points a memory block
- *          with length of @ref PRESENT_KEY_SIZE.
- *
- * @param[in] p_key Pointer of the crypt key.
- *
- * @return None.
- */
-static void
-present_generate_decrypt_key(uint8_t * p_key);
+/*****************************************************************************/
+/* ENGINE DEFINITIONS                                                        */
+/*****************************************************************************/
 
-/**
- * @brief Rotates the key to the left 61-bit.
- *
- * The function rotates the \p p_key to the left 61-bit. The function is
- * optimized for the PRESENT algorithm.
- *
- * @warning The function assumes the parameter \a p_key points a memory
- *          block with length of @ref PRESENT_KEY_SIZE.
- *
- * @param[in] p_key Pointer of the crypt key.
- *
- * @return None.
- */
-static void
-present_rotate_key_left(uint8_t * p_key);
-
-/**
- * @brief Rotates the key to the right 61-bit.
- *
- * The function rotates the \p p_key to the right 61-bit. The function is
- * optimized for the PRESENT algorithm.
- *
- * @warning The function assumes parameter \a p_key points a memory block
- *          with length of @ref PRESENT_KEY_SIZE.
- *
- * @param[in] p_key Pointer of the crypt key.
- *
- * @return None.
- */
-static void
-present_rotate_key_right(uint8_t * p_key);
+present_engine_t const g_present_engine_ref = {
+    "ref",
+    0u,
+    present_ref_encrypt_blocks,
+    present_ref_decrypt_blocks,
+    NULL,
+    NULL,
+    NULL
+};
 
 /*****************************************************************************/
 /* GLOBAL FUNCTION DEFINITIONS                                               */
 /*****************************************************************************/
 
+bool
+present_set_engine (present_engine_id_t engine)
+{
+    /*
+     * Never bind an engine that could not run on the host CPU.
+     */
+    if (!present_is_engine_supported(engine))
+    {
+        return false;
+    }
+
+    PRESENT_ENGINE_STORE(g_engines[engine]);
+
+    return true;
+}  /* present_set_engine() */
+
 void
-present_encrypt (uint8_t * p_text, uint8_t const * p_key)
+present_reset_engine (void)
 {
-    uint8_t subkey[PRESENT_KEY_SIZE];
-    uint8_t round = 1u;
+    char const * p_name = getenv(PRESENT_ENGINE_ENV);
+    uint8_t      engine;
 
-    ASSERT(NULL != p_text);
+    /*
+     * The engine given by the environment overrides the automatic
+     * selection, so that the engines could be compared without a rebuild.
+     */
+    if (NULL != p_name)
+    {
+        for (engine = 0u; engine < PRESENT_ENGINE_COUNT; engine++)
+        {
+            if ((NULL != g_engines[engine])
+                && (0 == strcmp(p_name, g_engines[engine]->p_name))
+                && present_set_engine((present_engine_id_t)engine))
+            {
+                return;
+            }
+        }
+    }
+
+    for (engine = 0u; engine < ARRAY_SIZE(g_engine_order); engine++)
+    {
+        if (present_set_engine(g_engine_order[engine]))
+        {
+            return;
+        }
+    }
+}  /* present_reset_engine() */
+
+present_engine_id_t
+present_get_engine (void)
+{
+    present_engine_t const * p_engine = present_active_engine();
+    uint8_t                  engine;
+
+    for (engine = 0u; engine < PRESENT_ENGINE_COUNT; engine++)
+    {
+        if (p_engine == g_engines[engine])
+        {
+            break;
+        }
+    }
+
+    return (present_engine_id_t)engine;
+}  /* present_get_engine() */
+
+char const *
+present_get_engine_name (present_engine_id_t engine)
+{
+    if ((engine >= PRESENT_ENGINE_COUNT) || (NULL == g_engines[engine]))
+    {
+        return NULL;
+    }
+
+    return g_engines[engine]->p_name;
+}  /* present_get_engine_name() */
+
+bool
+present_key_setup (present_ctx_t * p_ctx, uint8_t const * p_key, \
+                   size_t key_size)
+{
+    uint8_t round;
+
+    ASSERT(NULL != p_ctx);
     ASSERT(NULL != p_key);
 
-    /* 
-     * Copy the key into a buffer to keep original value unchanged during
-     * the encryption process.
+    /*
+     * Every key size has its own kernel, so the loops and the shifts of
+     * the schedule are constants in both of them.
      */
-    memcpy(subkey, p_key, PRESENT_KEY_SIZE);
+    if (PRESENT_KEY80_SIZE == key_size)
+    {
+        present_key_schedule80(p_ctx, p_key);
+    }
+    else if (PRESENT_KEY128_SIZE == key_size)
+    {
+        present_key_schedule128(p_ctx, p_key);
+    }
+    else
+    {
+        return false;
+    }
 
     /*
-     * Main loop of the PRESENT encryption algorithm.
+     * Move the round keys by the inverse permutation layer for the engines
+     * that merge the layers of the decryption.
      */
-    while (round <= PRESENT_ROUND_COUNT)
+    for (round = 0u; round <= PRESENT_ROUND_COUNT_MAX; round++)
     {
-        present_add_key(p_text, subkey);
-        present_substitution(p_text, PRESENT_OP_ENCRYPT);
-        present_permutation(p_text, PRESENT_OP_ENCRYPT);
+        p_ctx->inv_round_key[round] = \
+            present_permute64_inv(p_ctx->round_key[round]);
+    }
 
-        present_update_key(subkey, round, PRESENT_OP_ENCRYPT);
+    p_ctx->rounds = PRESENT_ROUND_COUNT;
 
-        round++;
-    };
+    return true;
+}  /* present_key_setup() */
 
-    /*
-     * Add the last subkey to finish the process.
-     */
-    present_add_key(p_text, subkey);
+bool
+present_key_setup_batch (present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                         size_t key_size, size_t count)
+{
+    present_engine_t const * p_engine;
+    size_t                   key;
+
+    ASSERT((NULL != p_ctx) || (0u == count));
+    ASSERT((NULL != p_keys) || (0u == count));
+
+    if ((PRESENT_KEY80_SIZE != key_size) && (PRESENT_KEY128_SIZE != key_size))
+    {
+        return false;
+    }
+
+    p_engine = present_active_engine();
+
+    if (NULL != p_engine->key_setup)
+    {
+        p_engine->key_setup(p_ctx, p_keys, key_size, count);
+        return true;
+    }
+
+    for (key = 0u; key < count; key++)
+    {
+        present_key_setup(&p_ctx[key], &p_keys[key * key_size], key_size);
+    }
+
+    return true;
+}  /* present_key_setup_batch() */
+
+bool
+present_set_round_count (present_ctx_t * p_ctx, uint8_t rounds)
+{
+    ASSERT(NULL != p_ctx);
+
+    if ((rounds < PRESENT_ROUND_COUNT_MIN)
+        || (rounds > PRESENT_ROUND_COUNT_MAX))
+    {
+        return false;
+    }
+
+    p_ctx->rounds = rounds;
+
+    return true;
+}  /* present_set_round_count() */
+
+void
+present_ctx_encrypt (present_ctx_t const * p_ctx, uint8_t * p_text)
+{
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_text);
+
+    present_active_engine()->encrypt(p_ctx, p_text, p_text, 1u);
+}  /* present_ctx_encrypt() */
+
+void
+present_ctx_decrypt (present_ctx_t const * p_ctx, uint8_t * p_text)
+{
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_text);
+
+    present_active_engine()->decrypt(p_ctx, p_text, p_text, 1u);
+}  /* present_ctx_decrypt() */
+
+void
+present_ctx_encrypt_to (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                        uint8_t const * p_src)
+{
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_dst);
+    ASSERT(NULL != p_src);
+
+    present_active_engine()->encrypt(p_ctx, p_dst, p_src, 1u);
+}  /* present_ctx_encrypt_to() */
+
+void
+present_ctx_decrypt_to (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                        uint8_t const * p_src)
+{
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_dst);
+    ASSERT(NULL != p_src);
+
+    present_active_engine()->decrypt(p_ctx, p_dst, p_src, 1u);
+}  /* present_ctx_decrypt_to() */
+
+void
+present_encrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                        uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_ctx);
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    present_active_engine()->encrypt(p_ctx, p_dst, p_src, count);
+}  /* present_encrypt_blocks() */
+
+void
+present_decrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                        uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_ctx);
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    present_active_engine()->decrypt(p_ctx, p_dst, p_src, count);
+}  /* present_decrypt_blocks() */
+
+bool
+present_encrypt_multi (present_ctx_t const * const * pp_ctx, \
+                       uint8_t * p_dst, uint8_t const * p_src, size_t count)
+{
+    present_engine_t const * p_engine;
+
+    ASSERT((NULL != pp_ctx) || (0u == count));
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    p_engine = present_active_engine();
+
+    return present_multi_crypt(p_engine->encrypt_multi, p_engine->encrypt, \
+                               pp_ctx, p_dst, p_src, count);
+}  /* present_encrypt_multi() */
+
+bool
+present_decrypt_multi (present_ctx_t const * const * pp_ctx, \
+                       uint8_t * p_dst, uint8_t const * p_src, size_t count)
+{
+    present_engine_t const * p_engine;
+
+    ASSERT((NULL != pp_ctx) || (0u == count));
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    p_engine = present_active_engine();
+
+    return present_multi_crypt(p_engine->decrypt_multi, p_engine->decrypt, \
+                               pp_ctx, p_dst, p_src, count);
+}  /* present_decrypt_multi() */
+
+void
+present_encrypt (uint8_t * p_text, uint8_t const * p_key)
+{
+    present_ctx_t ctx;
+
+    ASSERT(NULL != p_text);
+    ASSERT(NULL != p_key);
+
+    (void)present_key_setup(&ctx, p_key, PRESENT_KEY_SIZE);
+    present_ctx_encrypt(&ctx, p_text);
 }  /* present_encrypt() */
 
 void
 present_decrypt (uint8_t * p_text, uint8_t const * p_key)
 {
-    uint8_t subkey[PRESENT_KEY_SIZE];
-    uint8_t round = PRESENT_ROUND_COUNT;
+    present_ctx_t ctx;
 
     ASSERT(NULL != p_text);
     ASSERT(NULL != p_key);
 
-    /* 
-     * Copy the key into a buffer to keep original value unchanged during
-     * the decryption process.
+    (void)present_key_setup(&ctx, p_key, PRESENT_KEY_SIZE);
+    present_ctx_decrypt(&ctx, p_text);
+}  /* present_decrypt() */
+
+void
+present_encrypt_to (uint8_t * p_dst, uint8_t const * p_src, \
+                    uint8_t const * p_key)
+{
+    present_ctx_t ctx;
+
+    ASSERT(NULL != p_dst);
+    ASSERT(NULL != p_src);
+    ASSERT(NULL != p_key);
+
+    (void)present_key_setup(&ctx, p_key, PRESENT_KEY_SIZE);
+    present_ctx_encrypt_to(&ctx, p_dst, p_src);
+}  /* present_encrypt_to() */
+
+void
+present_decrypt_to (uint8_t * p_dst, uint8_t const * p_src, \
+                    uint8_t const * p_key)
+{
+    present_ctx_t ctx;
+
+    ASSERT(NULL != p_dst);
+    ASSERT(NULL != p_src);
+    ASSERT(NULL != p_key);
+
+    (void)present_key_setup(&ctx, p_key, PRESENT_KEY_SIZE);
+    present_ctx_decrypt_to(&ctx, p_dst, p_src);
+}  /* present_decrypt_to() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static bool
+present_is_engine_supported (present_engine_id_t engine)
+{
+    unsigned int features;
+
+    if ((engine >= PRESENT_ENGINE_COUNT) || (NULL == g_engines[engine]))
+    {
+        return false;
+    }
+
+    features = g_engines[engine]->features;
+
+    return (cpu_get_features() & features) == features;
+}  /* present_is_engine_supported() */
+
+static present_engine_t const *
+present_active_engine (void)
+{
+    present_engine_t const * p_engine;
+
+    p_engine = PRESENT_ENGINE_LOAD();
+
+    if (NULL == p_engine)
+    {
+        present_reset_engine();
+        p_engine = PRESENT_ENGINE_LOAD();
+    }
+
+    return p_engine;
+}  /* present_active_engine() */
+
+static bool
+present_multi_crypt (present_multi_fn_t multi, present_blocks_fn_t blocks, \
+                     present_ctx_t const * const * pp_ctx, uint8_t * p_dst, \
+                     uint8_t const * p_src, size_t count)
+{
+    size_t block;
+
+    for (block = 1u; block < count; block++)
+    {
+        ASSERT(NULL != pp_ctx[block]);
+
+        if (pp_ctx[block]->rounds != pp_ctx[0]->rounds)
+        {
+            return false;
+        }
+    }
+
+    if (NULL != multi)
+    {
+        multi(pp_ctx, p_dst, p_src, count);
+        return true;
+    }
+
+    for (block = 0u; block < count; block++)
+    {
+        blocks(pp_ctx[block], &p_dst[block * PRESENT_CRYPT_SIZE], \
+               &p_src[block * PRESENT_CRYPT_SIZE], 1u);
+    }
+
+    return true;
+}  /* present_multi_crypt() */
+
+static void
+present_ref_encrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_ctx);
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    /*
+     * Blocks are independent of each other in ECB mode. Copy every block
+     * to its destination and encrypt it while it is still in the cache.
      */
-    memcpy(subkey, p_key, PRESENT_KEY_SIZE);
+    while (count > 0u)
+    {
+        if (p_dst != p_src)
+        {
+            memcpy(p_dst, p_src, PRESENT_CRYPT_SIZE);
+        }
+
+        present_encrypt_block(p_ctx, p_dst);
+
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+        count--;
+    }
+}  /* present_ref_encrypt_blocks() */
+
+static void
+present_ref_decrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_ctx);
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
 
     /*
-     * Generate decryption key from the encryption key.
+     * Blocks are independent of each other in ECB mode. Copy every block
+     * to its destination and decrypt it while it is still in the cache.
      */
-    present_generate_decrypt_key(subkey);
+    while (count > 0u)
+    {
+        if (p_dst != p_src)
+        {
+            memcpy(p_dst, p_src, PRESENT_CRYPT_SIZE);
+        }
+
+        present_decrypt_block(p_ctx, p_dst);
+
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+        count--;
+    }
+}  /* present_ref_decrypt_blocks() */
+
+static void
+present_encrypt_block (present_ctx_t const * p_ctx, uint8_t * p_text)
+{
+    uint8_t round = 0u;
+
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_text);
+
+    /*
+     * Main loop of the PRESENT encryption algorithm.
+     */
+    while (round < p_ctx->rounds)
+    {
+        present_add_key(p_text, p_ctx->round_key[round]);
+        present_substitution(p_text, PRESENT_OP_ENCRYPT);
+        present_permutation(p_text, PRESENT_OP_ENCRYPT);
+
+        round++;
+    }
+
+    /*
+     * Add the last subkey to finish the process.
+     */
+    present_add_key(p_text, p_ctx->round_key[p_ctx->rounds]);
+}  /* present_encrypt_block() */
+
+static void
+present_decrypt_block (present_ctx_t const * p_ctx, uint8_t * p_text)
+{
+    uint8_t round;
+
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_text);
+
+    round = p_ctx->rounds;
 
     /*
      * Last step of the encryption process is the first step of
-     * the decryption. Add generated decryption key first.
+     * the decryption. Add the last subkey first.
      */
-    present_add_key(p_text, subkey);
+    present_add_key(p_text, p_ctx->round_key[round]);
 
     /*
-     * Main loop of the PRESENT decryption algorithm.
+     * Main loop of the PRESENT decryption algorithm. Subkeys are read from
+     * the schedule in reverse order.
      */
     while (round > 0u)
     {
+        round--;
+
         present_permutation(p_text, PRESENT_OP_DECRYPT);
         present_substitution(p_text, PRESENT_OP_DECRYPT);
-
-        present_update_key(subkey, round, PRESENT_OP_DECRYPT);
-        present_add_key(p_text, subkey);
-
-        round--;
+        present_add_key(p_text, p_ctx->round_key[round]);
     }
-}  /* present_decrypt() */
-
-/*****************************************************************************/
-/* STATIC FUNCTION DEFINITIONS                                               */
-/*****************************************************************************/
+}  /* present_decrypt_block() */
 
 static void
-present_add_key (uint8_t * p_text, uint8_t const * p_key)
+present_add_key (uint8_t * p_text, uint64_t round_key)
 {
     uint8_t byte;
 
     ASSERT(NULL != p_text);
-    ASSERT(NULL != p_key);
-
-    /*
-     * Move key pointer to the start byte of the key part that specified in
-     * the article. For further information, see article's section 3.
-     */
-    p_key += PRESENT_KEY_OFFSET;
 
     /*
-     * Adding key is simply logic XOR operation.
+     * Adding key is simply logic XOR operation. Bytes of the round key are
+     * taken from its least significant byte.
      */
     for (byte = 0u; byte < PRESENT_CRYPT_SIZE; byte++)
     {
-        p_text[byte] = p_text[byte] ^ p_key[byte];
+        p_text[byte] = p_text[byte] ^ (uint8_t)(round_key >> (8u * byte));
     }
 }  /* present_add_key() */
 
@@ -604,21 +1056,39 @@ present_encrypt_permutation (uint8_t * p_text)
     }
 
     /*
-     * Copy the new value to the cipher block.
+     * Copy the new value to the cipher block. The 16-bit blocks are stored
+     * byte by byte, so that the result does not depend on the byte order
+     * and the alignment of the host.
      */
-    memcpy(p_text, buff, PRESENT_CRYPT_SIZE);
+    for (byte = 0u; byte < PRESENT_PERMUTATION_BUFF_SIZE; byte++)
+    {
+        p_text[2u * byte]      = (uint8_t)(buff[byte] >> 0u);
+        p_text[2u * byte + 1u] = (uint8_t)(buff[byte] >> 8u);
+    }
 }  /* present_encrypt_permutation() */
 
 static void
 present_decrypt_permutation (uint8_t * p_text)
 {
-    uint8_t   buff[PRESENT_CRYPT_SIZE] = {0u};
-    uint16_t *p_block                  = (uint16_t *)p_text;
-    uint8_t   bit                      = 0u;
-    uint8_t   byte                     = 0u;
+    uint8_t  buff[PRESENT_CRYPT_SIZE]             = {0u};
+    uint16_t block[PRESENT_PERMUTATION_BUFF_SIZE];
+    uint8_t  bit                                  = 0u;
+    uint8_t  byte                                 = 0u;
 
     ASSERT(NULL != p_text);
 
+    /*
+     * Load the 16-bit blocks byte by byte instead of casting the text
+     * pointer, which could be unaligned.
+     */
+    for (byte = 0u; byte < PRESENT_PERMUTATION_BUFF_SIZE; byte++)
+    {
+        block[byte] = (uint16_t)(p_text[2u * byte]
+                                 | (p_text[2u * byte + 1u] << 8u));
+    }
+
+    byte = 0u;
+
     /*
      * Every new byte has two bits from every 16-bit blocks of the old
      * permutated text. In every step of the loop, bit values are picked
@@ -627,17 +1097,17 @@ present_decrypt_permutation (uint8_t * p_text)
      */
     while (byte < PRESENT_CRYPT_SIZE)
     {
-        buff[byte] |= BITVAL(p_block[0], (2 * bit))     << 0u;
-        buff[byte] |= BITVAL(p_block[0], (2 * bit) + 1) << 4u;
+        buff[byte] |= BITVAL(block[0], (2 * bit))     << 0u;
+        buff[byte] |= BITVAL(block[0], (2 * bit) + 1) << 4u;
 
-        buff[byte] |= BITVAL(p_block[1], (2 * bit))     << 1u;
-        buff[byte] |= BITVAL(p_block[1], (2 * bit) + 1) << 5u;
+        buff[byte] |= BITVAL(block[1], (2 * bit))     << 1u;
+        buff[byte] |= BITVAL(block[1], (2 * bit) + 1) << 5u;
 
-        buff[byte] |= BITVAL(p_block[2], (2 * bit))     << 2u;
-        buff[byte] |= BITVAL(p_block[2], (2 * bit) + 1) << 6u;
+        buff[byte] |= BITVAL(block[2], (2 * bit))     << 2u;
+        buff[byte] |= BITVAL(block[2], (2 * bit) + 1) << 6u;
 
-        buff[byte] |= BITVAL(p_block[3], (2 * bit))     << 3u;
-        buff[byte] |= BITVAL(p_block[3], (2 * bit) + 1) << 7u;
+        buff[byte] |= BITVAL(block[3], (2 * bit))     << 3u;
+        buff[byte] |= BITVAL(block[3], (2 * bit) + 1) << 7u;
 
         bit++;
         byte++;
@@ -650,244 +1120,88 @@ present_decrypt_permutation (uint8_t * p_text)
 }  /* present_decrypt_permutation() */
 
 static void
-present_update_key (uint8_t * p_key, uint8_t round_counter, present_op_t op)
-{
-    ASSERT(NULL != p_key);
-    ASSERT(round_counter >= PRESENT_ROUND_COUNT_MIN);
-    ASSERT(round_counter <= PRESENT_ROUND_COUNT_MAX);
-
-    switch (op)
-    {
-        case PRESENT_OP_ENCRYPT:
-            present_update_encrypt_key(p_key, round_counter);
-        break;
-
-        case PRESENT_OP_DECRYPT:
-            present_update_decrypt_key(p_key, round_counter);
-        break;
-
-        default:
-            /*
-             * An undefined operation occurred. Use forced assertion.
-             */
-            ASSERT(0);
-        break;
-    }
-}  /* present_update_key() */
-
-static void
-present_update_encrypt_key (uint8_t * p_key, uint8_t round_counter)
+present_key_schedule80 (present_ctx_t * p_ctx, uint8_t const * p_key)
 {
-    uint8_t high_nibble;
-    uint8_t low_nibble;
+    uint64_t low;
+    uint64_t high;
+    uint64_t rotated;
+    uint8_t  round;
 
+    ASSERT(NULL != p_ctx);
     ASSERT(NULL != p_key);
-    ASSERT(round_counter >= PRESENT_ROUND_COUNT_MIN);
-    ASSERT(round_counter <= PRESENT_ROUND_COUNT_MAX);
-
-    /*
-     * Rotate the key to the left as first step of the key scheduling.
-     */
-    present_rotate_key_left(p_key);
-
-    /*
-     * Substitute the MSB high nibble of the key.
-     */
-    high_nibble = (p_key[PRESENT_KEY_SIZE - 1] & 0xF0u) >> 4;
-    high_nibble = g_sbox[high_nibble];
-
-    low_nibble = p_key[PRESENT_KEY_SIZE - 1] & 0x0Fu;
 
-#if PRESENT_USE_KEY128
     /*
-     * Substitute the MSB low nibble if 128-bit key is used.
+     * The key register is the 16-bit high and the 64-bit low part.
      */
-    low_nibble = g_sbox[low_nibble];
-#endif  /* PRESENT_USE_KEY128 */
+    low  = present_load64(p_key);
+    high = (uint64_t)p_key[8] | ((uint64_t)p_key[9] << 8);
 
-    p_key[PRESENT_KEY_SIZE - 1] = (high_nibble << 4) | low_nibble;
-
-#if PRESENT_USE_KEY80
-    /*
-     * XOR the from 15th to 19th bits with the round counter.
-     */
-    p_key[2] ^= round_counter >> 1;
-    p_key[1] ^= round_counter << 7;
-#else  /* PRESENT_USE_KEY128 */
-    /*
-     * XOR the from 62th to 66th bits with the round counter.
-     */
-    p_key[8] ^= round_counter >> 2;
-    p_key[7] ^= round_counter << 6;
-#endif  /* PRESENT_USE_KEY128 */
-}  /* present_update_encrypt_key() */
-
-static void
-present_update_decrypt_key (uint8_t * p_key, uint8_t round_counter)
-{
-    uint8_t high_nibble;
-    uint8_t low_nibble;
-
-    ASSERT(NULL != p_key);
-    ASSERT(round_counter >= PRESENT_ROUND_COUNT_MIN);
-    ASSERT(round_counter <= PRESENT_ROUND_COUNT_MAX);
-
-#if PRESENT_USE_KEY80
-    /*
-     * XOR the from 15th to 19th bits with the round counter.
-     */
-    p_key[2] ^= round_counter >> 1;
-    p_key[1] ^= round_counter << 7;
-#else  /* PRESENT_USE_KEY128 */
-    /*
-     * XOR the from 62th to 66th bits with the round counter.
-     */
-    p_key[8] ^= round_counter >> 2;
-    p_key[7] ^= round_counter << 6;
-#endif  /* PRESENT_USE_KEY128 */
-
-    /*
-     * Substitute the MSB high nibble of the key.
-     */
-    high_nibble = (p_key[PRESENT_KEY_SIZE - 1] & 0xF0u) >> 4;
-    high_nibble = g_sbox_inv[high_nibble];
-
-    low_nibble = p_key[PRESENT_KEY_SIZE - 1] & 0x0Fu;
-
-#if PRESENT_USE_KEY128
-    /*
-     * Substitute the MSB low nibble if 128-bit key is used.
-     */
-    low_nibble = g_sbox_inv[low_nibble];
-#endif  /* PRESENT_USE_KEY128 */
-
-    p_key[PRESENT_KEY_SIZE - 1] = (high_nibble << 4) | low_nibble;
-
-    /*
-     * Rotate the key to the right to end the reverse scheduling.
-     */
-    present_rotate_key_right(p_key);
-}  /* present_update_decrypt_key() */
-
-static void
-present_generate_decrypt_key (uint8_t * p_key)
-{
-    uint8_t round;
-
-    ASSERT(NULL != p_key);
-
-    /*
-     * Start the loop from the first round.
-     */
-    round = 1u;
-
-    /*
-     * Update the key until the last round.
-     */
-    while (round <= PRESENT_ROUND_COUNT)
+    for (round = 1u; round <= PRESENT_ROUND_COUNT_MAX; round++)
     {
-        present_update_key(p_key, round, PRESENT_OP_ENCRYPT);
-        round++;
+        /*
+         * The round key is the 64 most significant bits of the register.
+         */
+        p_ctx->round_key[round - 1u] = (high << 48) | (low >> 16);
+
+        /*
+         * Rotate the register to the left 61-bit, which is the same as
+         * rotating to the right 19-bit.
+         */
+        rotated = (low >> 19) | (high << 45) | (low << 61);
+        high    = (low >> 3) & PRESENT_KEY80_HIGH_MASK;
+        low     = rotated;
+
+        /*
+         * Substitute the most significant nibble and XOR the bits from
+         * 15th to 19th with the round counter.
+         */
+        high  = (high & 0x0FFFu) | ((uint64_t)g_sbox[high >> 12] << 12);
+        low  ^= (uint64_t)round << 15;
     }
-}  /* present_generate_decrypt_key() */
-
-static void
-present_rotate_key_left (uint8_t * p_key)
-{
-    uint16_t   buff[PRESENT_ROTATE_BUFF_SIZE_LEFT];
-    uint16_t * p_block;
-    uint8_t    block;
-
-    uint8_t const rotation_point   = PRESENT_ROTATION_POINT_LEFT;
-    uint8_t const unrotated_blocks = PRESENT_UNROTATED_BLOCK_COUNT_LEFT;
-    uint8_t const lsb_offset       = PRESENT_ROTATION_LSB_OFFSET;
-    uint8_t const msb_offset       = PRESENT_ROTATION_MSB_OFFSET;
 
-    ASSERT(NULL != p_key);
-
-    p_block = (uint16_t *)p_key;
-
-    /*
-     * Fill the buffer with values that changes during the first loop.
-     */
-    for (block = 0u; block < PRESENT_ROTATE_BUFF_SIZE_LEFT; block++)
-    {
-        buff[block] = p_block[block];
-    }
-
-    /*
-     * Place the LSB 3-bit and the MSB 13-bit of the related blocks to the
-     * new place index until the rotation point.
-     */
-    for (block = 0u; block < rotation_point; block++)
-    {
-        p_block[block] = (p_block[block + lsb_offset] << 13) \
-                         | (p_block[block + msb_offset] >> 3);
-    }
-
-    /*
-     * Place the rotation point value by hand. Since the first block of the
-     * key has changed during the first loop, use the buffer value.
-     */
-    p_block[rotation_point] = (buff[0] << 13) \
-                              | (p_block[PRESENT_KEY_BLOCK_SIZE - 1] >> 3);
-
-    /*
-     * Fill the remain blocks with buffer values.
-     */
-    for (block = 0u; block < unrotated_blocks; block++)
-    {
-        p_block[block + 4] = (buff[block + 1] << 13) | (buff[block] >> 3);
-    }
-}  /* present_rotate_key_left() */
+    p_ctx->round_key[PRESENT_ROUND_COUNT_MAX] = (high << 48) | (low >> 16);
+}  /* present_key_schedule80() */
 
 static void
-present_rotate_key_right (uint8_t * p_key)
+present_key_schedule128 (present_ctx_t * p_ctx, uint8_t const * p_key)
 {
-    uint16_t   buff[PRESENT_ROTATE_BUFF_SIZE_RIGHT];
-    uint16_t * p_block;
-    uint8_t    block;
-
-    uint8_t const rotation_point   = PRESENT_ROTATION_POINT_RIGHT;
-    uint8_t const unrotated_blocks = PRESENT_UNROTATED_BLOCK_COUNT_RIGHT;
-    uint8_t const place_offset     = PRESENT_ROTATION_POINT_RIGHT + 1u;
+    uint64_t low;
+    uint64_t high;
+    uint64_t rotated;
+    uint8_t  round;
 
+    ASSERT(NULL != p_ctx);
     ASSERT(NULL != p_key);
 
-    p_block = (uint16_t *)p_key;
+    low  = present_load64(&p_key[0]);
+    high = present_load64(&p_key[PRESENT_CRYPT_SIZE]);
 
-    /*
-     * Fill the buffer with values that changes during the first loop.
-     */
-    for (block = 0u; block < PRESENT_ROTATE_BUFF_SIZE_RIGHT; block++)
-    {
-        buff[block] = p_block[block];
-    }
-
-    /*
-     * Place the LSB 13-bit and the MSB 3-bit of the related blocks to the
-     * new place index until the rotation point.
-     */
-    for (block = 0u; block < rotation_point; block++)
+    for (round = 1u; round <= PRESENT_ROUND_COUNT_MAX; round++)
     {
-        p_block[block] = (p_block[block + 4] << 3) | (p_block[block + 3] >> 13);
+        /*
+         * The round key is the 64 most significant bits of the register.
+         */
+        p_ctx->round_key[round - 1u] = high;
+
+        /*
+         * Rotate the register to the left 61-bit.
+         */
+        rotated = (low >> 3) | (high << 61);
+        low     = (high >> 3) | (low << 61);
+        high    = rotated;
+
+        /*
+         * Substitute the two most significant nibbles and XOR the bits
+         * from 62th to 66th with the round counter.
+         */
+        high  = (high & UINT64_C(0x00FFFFFFFFFFFFFF))
+                | ((uint64_t)g_sbox[high >> 60] << 60)
+                | ((uint64_t)g_sbox[(high >> 56) & 0x0Fu] << 56);
+        high ^= (uint64_t)round >> 2;
+        low  ^= (uint64_t)round << 62;
     }
 
-    /*
-     * Place the rotation point value by hand. Since the first block of key
-     * has changed during the first loop, use the buffer value.
-     */
-    p_block[rotation_point] = (buff[0] << 3) \
-                              | (p_block[PRESENT_KEY_BLOCK_SIZE - 1] >> 13);
-
-    /*
-     * Fill the remain blocks with buffer values.
-     */
-    for (block = 0u; block < unrotated_blocks; block++)
-    {
-        p_block[block + place_offset] = (buff[block + 1] << 3) \
-                                        | (buff[block] >> 13);
-    }
-}  /* present_rotate_key_right() */
+    p_ctx->round_key[PRESENT_ROUND_COUNT_MAX] = high;
+}  /* present_key_schedule128() */
 
 /*** END OF FILE ***/
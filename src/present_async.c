@@ -0,0 +1,944 @@
+/**
+ * @file present_async.c
+ * @brief Source file of the PRESENT asynchronous queue.
+ *
+ * The file is the C implementation of the PRESENT asynchronous queue. The
+ * file contains global and static function definitions, data structures,
+ * type definitions, etc, of the module.
+ *
+ * The rings are bounded queues with a sequence number per entry, so the
+ * pushes and the pops only race on a compare and swap of the ring
+ * positions. A submission reserves a place in flight first. As an entry
+ * stays in flight until its completion is reaped, neither ring could be
+ * full at a push. The mutex is only taken to sleep, and to wake the
+ * sleepers up.
+ *
+ * A worker keeps its bulk job on its own, and processes a chunk of it
+ * only when the high priority ring is empty. So, no job is ever put back
+ * to a ring.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+
+/*
+ * The count of the online CPUs and the monotonic clock are POSIX
+ * extensions.
+ */
+#if !defined(_POSIX_C_SOURCE)
+#   define _POSIX_C_SOURCE 200809L
+#endif  /* _POSIX_C_SOURCE */
+
+#include <present_async.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_ASYNC)
+
+#if CONF_PRESENT_ASYNC
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#   include <sys/eventfd.h>
+#endif  /* __linux__ */
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present_ctr.h>
+#include <assert.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if !CONF_PRESENT_SCHED
+#   error "Asynchronous queue requires the work-stealing scheduler module!"
+#endif
+
+#if (PRESENT_ASYNC_ENTRIES < 1u) \
+    || (PRESENT_ASYNC_ENTRIES & (PRESENT_ASYNC_ENTRIES - 1u))
+#   error "Ring entry count must be a power of two!"
+#endif
+
+#if (PRESENT_ASYNC_CHUNK < PRESENT_CRYPT_SIZE) \
+    || (PRESENT_ASYNC_CHUNK % PRESENT_CRYPT_SIZE)
+#   error "Bulk chunk size must be a multiple of the block size!"
+#endif
+
+#if (PRESENT_ASYNC_HIST_BUCKETS < 1u) || (PRESENT_ASYNC_HIST_BUCKETS > 64u)
+#   error "Histogram bucket count must be between 1 and 64!"
+#endif
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief Bulk job state type.
+ *
+ * This type holds the progress of the bulk job of a worker.
+ */
+typedef struct {
+    /*! The job. Its initialization vector is updated in CBC modes. */
+    present_async_job_t job;
+    /*! Counter mode state of the job. */
+    present_ctr_t       ctr;
+    /*! Count of the processed bytes. */
+    size_t              offset;
+    /*! True if the job is valid so far. */
+    bool                ok;
+    /*! True if the worker has a bulk job. */
+    bool                active;
+} present_async_bulk_t;
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Resets a ring.
+ *
+ * @param[out] p_ring Pointer of the ring.
+ *
+ * @return None.
+ */
+static void
+present_async_ring_init(present_async_ring_t * p_ring);
+
+/**
+ * @brief Claims the entry of a push.
+ *
+ * The caller owns the entry until it is published by
+ * @ref present_async_publish.
+ *
+ * @param[in,out] p_ring Pointer of the ring.
+ * @param[out]    p_pos  Pointer of the position of the entry.
+ *
+ * @return True if an entry is claimed, false if the ring is full.
+ */
+static bool
+present_async_claim_push(present_async_ring_t * p_ring, size_t * p_pos);
+
+/**
+ * @brief Publishes a pushed entry to the pops.
+ *
+ * @param[in,out] p_ring Pointer of the ring.
+ * @param[in]     pos    Position of the entry.
+ *
+ * @return None.
+ */
+static void
+present_async_publish(present_async_ring_t * p_ring, size_t pos);
+
+/**
+ * @brief Claims the entry of a pop.
+ *
+ * The caller owns the entry until it is released by
+ * @ref present_async_release.
+ *
+ * @param[in,out] p_ring Pointer of the ring.
+ * @param[out]    p_pos  Pointer of the position of the entry.
+ *
+ * @return True if an entry is claimed, false if the ring is empty.
+ */
+static bool
+present_async_claim_pop(present_async_ring_t * p_ring, size_t * p_pos);
+
+/**
+ * @brief Releases a popped entry to the pushes.
+ *
+ * @param[in,out] p_ring Pointer of the ring.
+ * @param[in]     pos    Position of the entry.
+ *
+ * @return None.
+ */
+static void
+present_async_release(present_async_ring_t * p_ring, size_t pos);
+
+/**
+ * @brief Checks whether a ring has an entry to pop.
+ *
+ * @param[in] p_ring Pointer of the ring.
+ *
+ * @return True if an entry is published at the head of the ring.
+ */
+static bool
+present_async_ready(present_async_ring_t const * p_ring);
+
+/**
+ * @brief Gets the monotonic time.
+ *
+ * @return The time in nanosecond.
+ */
+static uint64_t
+present_async_now(void);
+
+/**
+ * @brief Starts a bulk job.
+ *
+ * @param[out] p_bulk Pointer of the bulk job state.
+ * @param[in]  p_job  Pointer of the job.
+ *
+ * @return None.
+ */
+static void
+present_async_start(present_async_bulk_t * p_bulk, \
+                    present_async_job_t const * p_job);
+
+/**
+ * @brief Processes the next chunk of a bulk job.
+ *
+ * @param[in,out] p_bulk Pointer of the bulk job state.
+ *
+ * @return True if the job is done.
+ */
+static bool
+present_async_step(present_async_bulk_t * p_bulk);
+
+/**
+ * @brief Posts the completion of a job.
+ *
+ * The function adds the latency of the job to the histogram of its class,
+ * pushes its completion entry and wakes the caller up.
+ *
+ * @param[in,out] p_async Pointer of the queue.
+ * @param[in]     p_job   Pointer of the job.
+ * @param[in]     ok      Result of the job.
+ *
+ * @return None.
+ */
+static void
+present_async_post(present_async_t * p_async, \
+                   present_async_job_t const * p_job, bool ok);
+
+/**
+ * @brief Main function of the worker threads.
+ *
+ * @param[in,out] p_arg Pointer of the queue.
+ *
+ * @return NULL.
+ */
+static void *
+present_async_worker(void * p_arg);
+
+/**
+ * @brief Stops the first workers of the queue.
+ *
+ * @param[in,out] p_async Pointer of the queue.
+ * @param[in]     count   Count of the started workers.
+ *
+ * @return None.
+ */
+static void
+present_async_stop(present_async_t * p_async, size_t count);
+
+/**
+ * @brief Closes the event file descriptor of the queue.
+ *
+ * @param[in,out] p_async Pointer of the queue.
+ *
+ * @return None.
+ */
+static void
+present_async_close(present_async_t * p_async);
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+bool
+present_async_init (present_async_t * p_async, size_t threads)
+{
+    long   cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t worker;
+
+    ASSERT(NULL != p_async);
+
+    if (0u == threads)
+    {
+        threads = (cpus > 0) ? (size_t)cpus : 1u;
+    }
+
+    p_async->worker_count = threads;
+
+    if (p_async->worker_count > PRESENT_ASYNC_THREADS_MAX)
+    {
+        p_async->worker_count = PRESENT_ASYNC_THREADS_MAX;
+    }
+
+    present_async_ring_init(&p_async->sq[PRESENT_ASYNC_HIGH]);
+    present_async_ring_init(&p_async->sq[PRESENT_ASYNC_BULK]);
+    present_async_ring_init(&p_async->cq);
+    memset(p_async->hists, 0, sizeof(p_async->hists));
+
+    p_async->inflight = 0u;
+    p_async->sleepers = 0u;
+    p_async->waiters  = 0u;
+    p_async->stop     = false;
+    p_async->event_fd = -1;
+
+#if defined(__linux__)
+    p_async->event_fd = eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    if (p_async->event_fd < 0)
+    {
+        return false;
+    }
+#endif  /* __linux__ */
+
+    if (0 != pthread_mutex_init(&p_async->lock, NULL))
+    {
+        present_async_close(p_async);
+        return false;
+    }
+
+    if (0 != pthread_cond_init(&p_async->wake, NULL))
+    {
+        pthread_mutex_destroy(&p_async->lock);
+        present_async_close(p_async);
+        return false;
+    }
+
+    if (0 != pthread_cond_init(&p_async->ready, NULL))
+    {
+        pthread_cond_destroy(&p_async->wake);
+        pthread_mutex_destroy(&p_async->lock);
+        present_async_close(p_async);
+        return false;
+    }
+
+    for (worker = 0u; worker < p_async->worker_count; worker++)
+    {
+        if (0 != pthread_create(&p_async->workers[worker], NULL, \
+                                present_async_worker, p_async))
+        {
+            present_async_stop(p_async, worker);
+            return false;
+        }
+    }
+
+    return true;
+}  /* present_async_init() */
+
+void
+present_async_destroy (present_async_t * p_async)
+{
+    ASSERT(NULL != p_async);
+
+    present_async_stop(p_async, p_async->worker_count);
+}  /* present_async_destroy() */
+
+int
+present_async_fd (present_async_t const * p_async)
+{
+    ASSERT(NULL != p_async);
+
+    return p_async->event_fd;
+}  /* present_async_fd() */
+
+size_t
+present_async_submit (present_async_t * p_async, \
+                      present_async_sqe_t const * p_sqes, size_t count)
+{
+    present_async_ring_t * p_ring;
+    present_async_job_t *  p_job;
+    uint64_t               now      = present_async_now();
+    size_t                 inflight = __atomic_load_n(&p_async->inflight, \
+                                                      __ATOMIC_RELAXED);
+    size_t                 entry;
+    size_t                 pos;
+    bool                   claimed;
+
+    ASSERT(NULL != p_async);
+    ASSERT((NULL != p_sqes) || (0u == count));
+
+    for (entry = 0u; entry < count; entry++)
+    {
+        ASSERT(p_sqes[entry].priority < PRESENT_ASYNC_CLASSES);
+
+        /*
+         * Reserve a place in flight, which is also a free entry in both
+         * rings.
+         */
+        do
+        {
+            if (PRESENT_ASYNC_ENTRIES == inflight)
+            {
+                break;
+            }
+        } while (!__atomic_compare_exchange_n(&p_async->inflight, \
+                                              &inflight, inflight + 1u, \
+                                              true, __ATOMIC_ACQUIRE, \
+                                              __ATOMIC_RELAXED));
+
+        if (PRESENT_ASYNC_ENTRIES == inflight)
+        {
+            break;
+        }
+
+        inflight++;
+
+        p_ring  = &p_async->sq[p_sqes[entry].priority];
+        claimed = present_async_claim_push(p_ring, &pos);
+        ASSERT(claimed);
+
+        p_job = &p_async->jobs[p_sqes[entry].priority] \
+                              [pos % PRESENT_ASYNC_ENTRIES];
+
+        p_job->sqe       = p_sqes[entry];
+        p_job->submit_ns = now;
+        present_async_publish(p_ring, pos);
+    }
+
+    if ((entry > 0u)
+        && (0u != __atomic_load_n(&p_async->sleepers, __ATOMIC_SEQ_CST)))
+    {
+        pthread_mutex_lock(&p_async->lock);
+        pthread_cond_broadcast(&p_async->wake);
+        pthread_mutex_unlock(&p_async->lock);
+    }
+
+    return entry;
+}  /* present_async_submit() */
+
+size_t
+present_async_reap (present_async_t * p_async, present_async_cqe_t * p_cqes, \
+                    size_t max)
+{
+    size_t   taken = 0u;
+    size_t   pos;
+#if defined(__linux__)
+    uint64_t events;
+    ssize_t  result;
+#endif  /* __linux__ */
+
+    ASSERT(NULL != p_async);
+    ASSERT((NULL != p_cqes) || (0u == max));
+
+#if defined(__linux__)
+    /*
+     * Reset the event before the pops, so that a completion posted after
+     * the last pop sets it again.
+     */
+    result = read(p_async->event_fd, &events, sizeof(events));
+    (void)result;
+#endif  /* __linux__ */
+
+    while ((taken < max) && present_async_claim_pop(&p_async->cq, &pos))
+    {
+        p_cqes[taken++] = p_async->cqes[pos % PRESENT_ASYNC_ENTRIES];
+        present_async_release(&p_async->cq, pos);
+    }
+
+    __atomic_fetch_sub(&p_async->inflight, taken, __ATOMIC_RELEASE);
+
+#if defined(__linux__)
+    /*
+     * Leave the event set for the completions that did not fit.
+     */
+    if (present_async_ready(&p_async->cq))
+    {
+        events = 1u;
+        result = write(p_async->event_fd, &events, sizeof(events));
+        (void)result;
+    }
+#endif  /* __linux__ */
+
+    return taken;
+}  /* present_async_reap() */
+
+size_t
+present_async_wait (present_async_t * p_async, present_async_cqe_t * p_cqes, \
+                    size_t max)
+{
+    size_t taken;
+
+    ASSERT(NULL != p_async);
+    ASSERT(NULL != p_cqes);
+    ASSERT(max > 0u);
+
+    while (0u == (taken = present_async_reap(p_async, p_cqes, max)))
+    {
+        pthread_mutex_lock(&p_async->lock);
+        __atomic_fetch_add(&p_async->waiters, 1u, __ATOMIC_SEQ_CST);
+
+        /*
+         * A job in flight without a completion is still running, so its
+         * completion wakes the caller up.
+         */
+        while (!present_async_ready(&p_async->cq)
+               && (0u != __atomic_load_n(&p_async->inflight, \
+                                         __ATOMIC_ACQUIRE)))
+        {
+            pthread_cond_wait(&p_async->ready, &p_async->lock);
+        }
+
+        __atomic_fetch_sub(&p_async->waiters, 1u, __ATOMIC_SEQ_CST);
+        pthread_mutex_unlock(&p_async->lock);
+
+        if (0u == __atomic_load_n(&p_async->inflight, __ATOMIC_ACQUIRE))
+        {
+            break;
+        }
+    }
+
+    return taken;
+}  /* present_async_wait() */
+
+void
+present_async_hist (present_async_t * p_async, \
+                    present_async_class_t priority, \
+                    present_async_hist_t * p_hist)
+{
+    present_async_hist_t const * p_src;
+    size_t                       bucket;
+
+    ASSERT(NULL != p_async);
+    ASSERT(priority < PRESENT_ASYNC_CLASSES);
+    ASSERT(NULL != p_hist);
+
+    p_src = &p_async->hists[priority];
+
+    for (bucket = 0u; bucket < PRESENT_ASYNC_HIST_BUCKETS; bucket++)
+    {
+        p_hist->buckets[bucket] = __atomic_load_n(&p_src->buckets[bucket], \
+                                                  __ATOMIC_RELAXED);
+    }
+
+    p_hist->count    = __atomic_load_n(&p_src->count, __ATOMIC_RELAXED);
+    p_hist->total_ns = __atomic_load_n(&p_src->total_ns, __ATOMIC_RELAXED);
+}  /* present_async_hist() */
+
+uint64_t
+present_async_percentile (present_async_hist_t const * p_hist, \
+                          unsigned percent)
+{
+    unsigned long seen = 0u;
+    unsigned long rank;
+    size_t        bucket;
+
+    ASSERT(NULL != p_hist);
+    ASSERT((percent >= 1u) && (percent <= 100u));
+
+    /*
+     * The buckets are counted one by one, so their sum could differ from
+     * the count while the workers run.
+     */
+    for (bucket = 0u; bucket < PRESENT_ASYNC_HIST_BUCKETS; bucket++)
+    {
+        seen += p_hist->buckets[bucket];
+    }
+
+    rank = (seen * percent + 99u) / 100u;
+    seen = 0u;
+
+    for (bucket = 0u; (bucket < PRESENT_ASYNC_HIST_BUCKETS) && (rank > 0u);
+         bucket++)
+    {
+        seen += p_hist->buckets[bucket];
+
+        if (seen >= rank)
+        {
+            return (bucket < 63u) ? (UINT64_C(2) << bucket) - 1u \
+                                  : UINT64_MAX;
+        }
+    }
+
+    return 0u;
+}  /* present_async_percentile() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static void
+present_async_ring_init (present_async_ring_t * p_ring)
+{
+    size_t entry;
+
+    p_ring->head = 0u;
+    p_ring->tail = 0u;
+
+    for (entry = 0u; entry < PRESENT_ASYNC_ENTRIES; entry++)
+    {
+        p_ring->seq[entry] = entry;
+    }
+}  /* present_async_ring_init() */
+
+static bool
+present_async_claim_push (present_async_ring_t * p_ring, size_t * p_pos)
+{
+    size_t    pos = __atomic_load_n(&p_ring->tail, __ATOMIC_RELAXED);
+    ptrdiff_t diff;
+
+    for (;;)
+    {
+        diff = (ptrdiff_t)(__atomic_load_n(&p_ring->seq[pos \
+                                           % PRESENT_ASYNC_ENTRIES], \
+                                           __ATOMIC_ACQUIRE) - pos);
+
+        if (diff < 0)
+        {
+            return false;
+        }
+
+        /*
+         * A failed swap reloads the position for the next try.
+         */
+        if ((0 == diff)
+            && __atomic_compare_exchange_n(&p_ring->tail, &pos, pos + 1u, \
+                                           true, __ATOMIC_RELAXED, \
+                                           __ATOMIC_RELAXED))
+        {
+            break;
+        }
+
+        if (diff > 0)
+        {
+            pos = __atomic_load_n(&p_ring->tail, __ATOMIC_RELAXED);
+        }
+    }
+
+    *p_pos = pos;
+
+    return true;
+}  /* present_async_claim_push() */
+
+static void
+present_async_publish (present_async_ring_t * p_ring, size_t pos)
+{
+    /*
+     * The store is sequentially consistent, so either a sleeper sees the
+     * entry or the pusher sees the sleeper.
+     */
+    __atomic_store_n(&p_ring->seq[pos % PRESENT_ASYNC_ENTRIES], pos + 1u, \
+                     __ATOMIC_SEQ_CST);
+}  /* present_async_publish() */
+
+static bool
+present_async_claim_pop (present_async_ring_t * p_ring, size_t * p_pos)
+{
+    size_t    pos = __atomic_load_n(&p_ring->head, __ATOMIC_RELAXED);
+    ptrdiff_t diff;
+
+    for (;;)
+    {
+        diff = (ptrdiff_t)(__atomic_load_n(&p_ring->seq[pos \
+                                           % PRESENT_ASYNC_ENTRIES], \
+                                           __ATOMIC_ACQUIRE) - (pos + 1u));
+
+        if (diff < 0)
+        {
+            return false;
+        }
+
+        if ((0 == diff)
+            && __atomic_compare_exchange_n(&p_ring->head, &pos, pos + 1u, \
+                                           true, __ATOMIC_RELAXED, \
+                                           __ATOMIC_RELAXED))
+        {
+            break;
+        }
+
+        if (diff > 0)
+        {
+            pos = __atomic_load_n(&p_ring->head, __ATOMIC_RELAXED);
+        }
+    }
+
+    *p_pos = pos;
+
+    return true;
+}  /* present_async_claim_pop() */
+
+static void
+present_async_release (present_async_ring_t * p_ring, size_t pos)
+{
+    __atomic_store_n(&p_ring->seq[pos % PRESENT_ASYNC_ENTRIES], \
+                     pos + PRESENT_ASYNC_ENTRIES, __ATOMIC_RELEASE);
+}  /* present_async_release() */
+
+static bool
+present_async_ready (present_async_ring_t const * p_ring)
+{
+    size_t pos = __atomic_load_n(&p_ring->head, __ATOMIC_SEQ_CST);
+
+    return (pos + 1u) == __atomic_load_n(&p_ring->seq[pos \
+                                         % PRESENT_ASYNC_ENTRIES], \
+                                         __ATOMIC_SEQ_CST);
+}  /* present_async_ready() */
+
+static uint64_t
+present_async_now (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * UINT64_C(1000000000) \
+           + (uint64_t)now.tv_nsec;
+}  /* present_async_now() */
+
+static void
+present_async_start (present_async_bulk_t * p_bulk, \
+                     present_async_job_t const * p_job)
+{
+    present_async_sqe_t const * p_sqe = &p_job->sqe;
+
+    p_bulk->job    = *p_job;
+    p_bulk->offset = 0u;
+    p_bulk->active = true;
+
+    if (PRESENT_SCHED_CTR == p_sqe->op)
+    {
+        /*
+         * Refuse a message that passes the counter space before its first
+         * chunk is processed.
+         */
+        p_bulk->ok = present_ctr_init(&p_bulk->ctr, p_sqe->p_ctx, \
+                                      p_sqe->iv, p_sqe->counter_bits) \
+                     && present_ctr_check(&p_bulk->ctr, p_sqe->size);
+    }
+    else
+    {
+        p_bulk->ok = (p_sqe->op <= PRESENT_SCHED_CBC_DECRYPT) \
+                     && (0u == p_sqe->size % PRESENT_CRYPT_SIZE);
+    }
+}  /* present_async_start() */
+
+static bool
+present_async_step (present_async_bulk_t * p_bulk)
+{
+    present_async_sqe_t * p_sqe = &p_bulk->job.sqe;
+    size_t                part  = p_sqe->size - p_bulk->offset;
+
+    part = (part < PRESENT_ASYNC_CHUNK) ? part : PRESENT_ASYNC_CHUNK;
+
+    /*
+     * The counter mode keeps its state between the chunks, and the CBC
+     * modes keep it in the initialization vector.
+     */
+    if (!p_bulk->ok || (0u == part))
+    {
+        return true;
+    }
+    else if (PRESENT_SCHED_CTR == p_sqe->op)
+    {
+        (void)present_ctr_crypt(&p_bulk->ctr, \
+                                &p_sqe->p_dst[p_bulk->offset], \
+                                &p_sqe->p_src[p_bulk->offset], part);
+    }
+    else
+    {
+        p_bulk->ok = present_sched_crypt(p_sqe->op, p_sqe->p_ctx, p_sqe->iv, \
+                                         p_sqe->counter_bits, \
+                                         &p_sqe->p_dst[p_bulk->offset], \
+                                         &p_sqe->p_src[p_bulk->offset], part);
+    }
+
+    p_bulk->offset += part;
+
+    return !p_bulk->ok || (p_bulk->offset == p_sqe->size);
+}  /* present_async_step() */
+
+static void
+present_async_post (present_async_t * p_async, \
+                    present_async_job_t const * p_job, bool ok)
+{
+    present_async_hist_t * p_hist  = &p_async->hists[p_job->sqe.priority];
+    present_async_cqe_t    cqe;
+    uint64_t               latency = present_async_now() - p_job->submit_ns;
+    size_t                 bucket  = 0u;
+    size_t                 pos;
+    bool                   claimed;
+#if defined(__linux__)
+    uint64_t               event   = 1u;
+    ssize_t                result;
+#endif  /* __linux__ */
+
+    while ((bucket < PRESENT_ASYNC_HIST_BUCKETS - 1u)
+           && ((latency >> (bucket + 1u)) > 0u))
+    {
+        bucket++;
+    }
+
+    /*
+     * Count the job before its completion, so that a reaped job is always
+     * in the histogram.
+     */
+    __atomic_fetch_add(&p_hist->buckets[bucket], 1ul, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&p_hist->total_ns, latency, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&p_hist->count, 1ul, __ATOMIC_RELAXED);
+
+    cqe.user_data = p_job->sqe.user_data;
+    cqe.ok        = ok;
+
+    claimed = present_async_claim_push(&p_async->cq, &pos);
+    ASSERT(claimed);
+
+    p_async->cqes[pos % PRESENT_ASYNC_ENTRIES] = cqe;
+    present_async_publish(&p_async->cq, pos);
+
+#if defined(__linux__)
+    result = write(p_async->event_fd, &event, sizeof(event));
+    (void)result;
+#endif  /* __linux__ */
+
+    if (0u != __atomic_load_n(&p_async->waiters, __ATOMIC_SEQ_CST))
+    {
+        pthread_mutex_lock(&p_async->lock);
+        pthread_cond_broadcast(&p_async->ready);
+        pthread_mutex_unlock(&p_async->lock);
+    }
+}  /* present_async_post() */
+
+static void *
+present_async_worker (void * p_arg)
+{
+    present_async_t *      p_async = (present_async_t *)p_arg;
+    present_async_job_t    job;
+    present_async_bulk_t   bulk;
+    present_async_ring_t * p_ring;
+    size_t                 pos;
+    bool                   ok;
+
+    bulk.active = false;
+
+    for (;;)
+    {
+        p_ring = &p_async->sq[PRESENT_ASYNC_HIGH];
+
+        if (present_async_claim_pop(p_ring, &pos))
+        {
+            job = p_async->jobs[PRESENT_ASYNC_HIGH] \
+                               [pos % PRESENT_ASYNC_ENTRIES];
+            present_async_release(p_ring, pos);
+
+            ok = present_sched_crypt(job.sqe.op, job.sqe.p_ctx, job.sqe.iv, \
+                                     job.sqe.counter_bits, job.sqe.p_dst, \
+                                     job.sqe.p_src, job.sqe.size);
+            present_async_post(p_async, &job, ok);
+            continue;
+        }
+
+        if (bulk.active)
+        {
+            if (present_async_step(&bulk))
+            {
+                bulk.active = false;
+                present_async_post(p_async, &bulk.job, bulk.ok);
+            }
+            continue;
+        }
+
+        p_ring = &p_async->sq[PRESENT_ASYNC_BULK];
+
+        if (present_async_claim_pop(p_ring, &pos))
+        {
+            present_async_start(&bulk, \
+                                &p_async->jobs[PRESENT_ASYNC_BULK] \
+                                              [pos % PRESENT_ASYNC_ENTRIES]);
+            present_async_release(p_ring, pos);
+            continue;
+        }
+
+        pthread_mutex_lock(&p_async->lock);
+        __atomic_fetch_add(&p_async->sleepers, 1u, __ATOMIC_SEQ_CST);
+
+        while (!p_async->stop
+               && !present_async_ready(&p_async->sq[PRESENT_ASYNC_HIGH])
+               && !present_async_ready(&p_async->sq[PRESENT_ASYNC_BULK]))
+        {
+            pthread_cond_wait(&p_async->wake, &p_async->lock);
+        }
+
+        __atomic_fetch_sub(&p_async->sleepers, 1u, __ATOMIC_SEQ_CST);
+
+        /*
+         * The submitted jobs are drained before the exit.
+         */
+        if (p_async->stop
+            && !present_async_ready(&p_async->sq[PRESENT_ASYNC_HIGH])
+            && !present_async_ready(&p_async->sq[PRESENT_ASYNC_BULK]))
+        {
+            pthread_mutex_unlock(&p_async->lock);
+            break;
+        }
+
+        pthread_mutex_unlock(&p_async->lock);
+    }
+
+    return NULL;
+}  /* present_async_worker() */
+
+static void
+present_async_stop (present_async_t * p_async, size_t count)
+{
+    size_t worker;
+
+    pthread_mutex_lock(&p_async->lock);
+
+    p_async->stop = true;
+    pthread_cond_broadcast(&p_async->wake);
+
+    pthread_mutex_unlock(&p_async->lock);
+
+    for (worker = 0u; worker < count; worker++)
+    {
+        pthread_join(p_async->workers[worker], NULL);
+    }
+
+    pthread_cond_destroy(&p_async->ready);
+    pthread_cond_destroy(&p_async->wake);
+    pthread_mutex_destroy(&p_async->lock);
+
+    present_async_close(p_async);
+}  /* present_async_stop() */
+
+static void
+present_async_close (present_async_t * p_async)
+{
+    if (p_async->event_fd >= 0)
+    {
+        close(p_async->event_fd);
+        p_async->event_fd = -1;
+    }
+}  /* present_async_close() */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_async_unused_t;
+
+#endif  /* CONF_PRESENT_ASYNC */
+
+/*** END OF FILE ***/
@@ -0,0 +1,493 @@
+/**
+ * @file present_bitslice.c
+ * @brief Source file of the PRESENT bitsliced engine.
+ *
+ * The file is the C implementation of the PRESENT crypt engine that
+ * processes 64 text blocks in parallel. The file contains global and static
+ * function definitions, data structures, type definitions, etc, of the
+ * engine.
+ *
+ * The blocks are transposed into the bitsliced layout: the word i of the
+ * sliced state holds the bit i of all the blocks. The substitution layer is
+ * a short sequence of boolean operations on four words, and the
+ * permutation layer is only a renaming of the words, so it costs nothing.
+ *
+ * Blocks that do not fill a whole batch are processed by the table engine.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @see <a href=
+ *      "https://link.springer.com/chapter/10.1007%2F978-3-540-74735-2_31">
+ *      PRESENT: An Ultra-Lightweight Block Cipher</a>
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_engine.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_BITSLICE)
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <assert.h>
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Count of the nibbles in a text block.
+ */
+#define PRESENT_NIBBLE_COUNT (PRESENT_CRYPT_BIT_SIZE / 4u)
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Transposes a 64x64 bit matrix.
+ *
+ * The function moves the bit j of the word i of \p p_words to the bit i of
+ * the word j. The same function converts the blocks into the bitsliced
+ * layout and back.
+ *
+ * @param[in] p_words Pointer of the 64 words.
+ *
+ * @return None.
+ */
+static void
+present_bitslice_transpose(uint64_t * p_words);
+
+/**
+ * @brief Add key layer of the algorithm on the sliced state.
+ *
+ * The function adds \p round_key to all the blocks of \p p_state. Every
+ * bit of the round key is expanded to a whole word.
+ *
+ * @param[in] p_state   Pointer of the sliced state.
+ * @param[in] round_key The round key.
+ *
+ * @return None.
+ */
+static void
+present_bitslice_add_key(uint64_t * p_state, uint64_t round_key);
+
+/**
+ * @brief Substitution and permutation layers on the sliced state.
+ *
+ * The function substitutes every nibble of \p p_in with boolean operations
+ * and writes the output bits to their permutated words in \p p_out.
+ *
+ * @param[out] p_out Pointer of the output sliced state.
+ * @param[in]  p_in  Pointer of the input sliced state.
+ *
+ * @return None.
+ */
+static void
+present_bitslice_round(uint64_t * p_out, uint64_t const * p_in);
+
+/**
+ * @brief Inverse permutation and substitution layers on the sliced state.
+ *
+ * The function reads every nibble of \p p_in from its inverse permutated
+ * words, inverse substitutes it with boolean operations and writes it to
+ * \p p_out.
+ *
+ * @param[out] p_out Pointer of the output sliced state.
+ * @param[in]  p_in  Pointer of the input sliced state.
+ *
+ * @return None.
+ */
+static void
+present_bitslice_round_inv(uint64_t * p_out, uint64_t const * p_in);
+
+/**
+ * @brief Gets the engine of the remaining blocks.
+ *
+ * The function selects the engine that processes the blocks which do not
+ * fill a whole batch. It is the SSSE3 engine if the host CPU supports it,
+ * and the table engine otherwise.
+ *
+ * @return Pointer of the engine.
+ */
+static present_engine_t const *
+present_bitslice_tail_engine(void);
+
+/**
+ * @brief Encryption kernel of the bitsliced engine.
+ *
+ * The function encrypts \p count blocks of \p p_src with \p rounds rounds
+ * and writes them to \p p_dst.
+ *
+ * @param[in]  p_ctx  Pointer of the crypt context.
+ * @param[out] p_dst  Pointer of the crypted text buffer.
+ * @param[in]  p_src  Pointer of the raw text buffer.
+ * @param[in]  count  Count of the blocks.
+ * @param[in]  rounds Count of the rounds.
+ *
+ * @return None.
+ */
+static PRESENT_INLINE void
+present_bitslice_encrypt_kernel(present_ctx_t const * p_ctx, \
+                                uint8_t * p_dst, uint8_t const * p_src, \
+                                size_t count, uint8_t rounds);
+
+/**
+ * @brief Decryption kernel of the bitsliced engine.
+ *
+ * The function decrypts \p count blocks of \p p_src with \p rounds rounds
+ * and writes them to \p p_dst.
+ *
+ * @param[in]  p_ctx  Pointer of the crypt context.
+ * @param[out] p_dst  Pointer of the raw text buffer.
+ * @param[in]  p_src  Pointer of the crypted text buffer.
+ * @param[in]  count  Count of the blocks.
+ * @param[in]  rounds Count of the rounds.
+ *
+ * @return None.
+ */
+static PRESENT_INLINE void
+present_bitslice_decrypt_kernel(present_ctx_t const * p_ctx, \
+                                uint8_t * p_dst, uint8_t const * p_src, \
+                                size_t count, uint8_t rounds);
+
+/**
+ * @brief Encrypts consecutive text blocks with the bitsliced engine.
+ *
+ * The function is the multi-block encryption function of the bitsliced
+ * engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the crypted text buffer.
+ * @param[in]  p_src Pointer of the raw text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_bitslice_encrypt_blocks(present_ctx_t const * p_ctx, \
+                                uint8_t * p_dst, uint8_t const * p_src, \
+                                size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with the bitsliced engine.
+ *
+ * The function is the multi-block decryption function of the bitsliced
+ * engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the raw text buffer.
+ * @param[in]  p_src Pointer of the crypted text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_bitslice_decrypt_blocks(present_ctx_t const * p_ctx, \
+                                uint8_t * p_dst, uint8_t const * p_src, \
+                                size_t count);
+
+/*****************************************************************************/
+/* ENGINE DEFINITIONS                                                        */
+/*****************************************************************************/
+
+present_engine_t const g_present_engine_bitslice = {
+    "bitslice",
+    0u,
+    present_bitslice_encrypt_blocks,
+    present_bitslice_decrypt_blocks,
+    NULL,
+    NULL,
+    NULL
+};
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static void
+present_bitslice_transpose (uint64_t * p_words)
+{
+    uint64_t mask  = UINT64_C(0x00000000FFFFFFFF);
+    uint64_t swap;
+    uint8_t  width = 32u;
+    uint8_t  word;
+
+    ASSERT(NULL != p_words);
+
+    /*
+     * Swap the off-diagonal blocks of every 2x2 block matrix, starting from
+     * 32x32 blocks down to single bits.
+     */
+    while (width > 0u)
+    {
+        for (word = 0u; word < PRESENT_BITSLICE_LANES; \
+             word = ((word | width) + 1u) & ~width)
+        {
+            swap = ((p_words[word] >> width) ^ p_words[word | width]) & mask;
+
+            p_words[word | width] ^= swap;
+            p_words[word]         ^= swap << width;
+        }
+
+        width >>= 1;
+        mask  ^= mask << width;
+    }
+}  /* present_bitslice_transpose() */
+
+static void
+present_bitslice_add_key (uint64_t * p_state, uint64_t round_key)
+{
+    uint8_t bit;
+
+    for (bit = 0u; bit < PRESENT_CRYPT_BIT_SIZE; bit++)
+    {
+        p_state[bit] ^= (uint64_t)0u - ((round_key >> bit) & 1u);
+    }
+}  /* present_bitslice_add_key() */
+
+static void
+present_bitslice_round (uint64_t * p_out, uint64_t const * p_in)
+{
+    uint64_t x0, x1, x2, x3;
+    uint64_t t1, t2, t3, t4, t5;
+    uint8_t  nibble;
+
+    for (nibble = 0u; nibble < PRESENT_NIBBLE_COUNT; nibble++)
+    {
+        /*
+         * x0 is the most and x3 is the least significant bit of the nibble.
+         */
+        x0 = p_in[4u * nibble + 3u];
+        x1 = p_in[4u * nibble + 2u];
+        x2 = p_in[4u * nibble + 1u];
+        x3 = p_in[4u * nibble + 0u];
+
+        /*
+         * Boolean form of the lookup table @ref g_sbox.
+         */
+        t1 = x2 ^ x1;
+        t2 = x1 & t1;
+        t3 = x0 ^ t2;
+        t5 = x3 ^ t3;
+        t2 = t1 & t3;
+        t1 = t1 ^ t5;
+        t2 = t2 ^ x1;
+        t4 = x3 | t2;
+
+        /*
+         * Bit b of the nibble n moves to the bit 16 * b + n.
+         */
+        p_out[nibble + 16u] = t1 ^ t4;
+        t2                  = t2 ^ ~x3;
+        p_out[nibble + 48u] = t2 ^ p_out[nibble + 16u];
+        t2                  = t2 | t1;
+        p_out[nibble + 32u] = t3 ^ t2;
+        p_out[nibble +  0u] = t5;
+    }
+}  /* present_bitslice_round() */
+
+static void
+present_bitslice_round_inv (uint64_t * p_out, uint64_t const * p_in)
+{
+    uint64_t x0, x1, x2, x3;
+    uint64_t t12, t13, t23, u;
+    uint8_t  nibble;
+
+    for (nibble = 0u; nibble < PRESENT_NIBBLE_COUNT; nibble++)
+    {
+        /*
+         * Bit b of the nibble n came from the bit 16 * b + n. x0 is the
+         * least and x3 is the most significant bit of the nibble.
+         */
+        x0 = p_in[nibble +  0u];
+        x1 = p_in[nibble + 16u];
+        x2 = p_in[nibble + 32u];
+        x3 = p_in[nibble + 48u];
+
+        /*
+         * Boolean form of the lookup table @ref g_sbox_inv.
+         */
+        t12 = x1 & x2;
+        t13 = x1 & x3;
+        t23 = x2 & x3;
+        u   = t12 ^ t23;
+
+        p_out[4u * nibble + 0u] = ~(x0 ^ x2 ^ t13);
+        p_out[4u * nibble + 1u] = x0 ^ x1 ^ x3 ^ t13 ^ t23 \
+                                  ^ (x0 & (x2 ^ u ^ t13));
+        p_out[4u * nibble + 2u] = ~(x3 ^ t12 ^ t13 \
+                                    ^ (x0 & (x1 ^ x2 ^ x3 ^ u ^ t13)));
+        p_out[4u * nibble + 3u] = x0 ^ x1 ^ x2 ^ x3 ^ (x0 & (x1 ^ u));
+    }
+}  /* present_bitslice_round_inv() */
+
+static present_engine_t const *
+present_bitslice_tail_engine (void)
+{
+#if CPU_USE_X86
+    if (cpu_get_features() & CPU_FEATURE_SSSE3)
+    {
+        return &g_present_engine_ssse3;
+    }
+#endif  /* CPU_USE_X86 */
+
+    return &g_present_engine_table;
+}  /* present_bitslice_tail_engine() */
+
+static PRESENT_INLINE void
+present_bitslice_encrypt_kernel (present_ctx_t const * p_ctx, \
+                                 uint8_t * p_dst, uint8_t const * p_src, \
+                                 size_t count, uint8_t rounds)
+{
+    uint64_t  state[2u][PRESENT_BITSLICE_LANES];
+    uint64_t *p_in;
+    uint64_t *p_out;
+    uint64_t *p_swap;
+    uint8_t   round;
+    uint8_t   lane;
+
+    while (count >= PRESENT_BITSLICE_LANES)
+    {
+        p_in  = state[0];
+        p_out = state[1];
+
+        for (lane = 0u; lane < PRESENT_BITSLICE_LANES; lane++)
+        {
+            p_in[lane] = present_load64(&p_src[lane * PRESENT_CRYPT_SIZE]);
+        }
+
+        present_bitslice_transpose(p_in);
+
+        /*
+         * Every round writes its output to the other buffer of the state.
+         */
+        for (round = 0u; round < rounds; round++)
+        {
+            present_bitslice_add_key(p_in, p_ctx->round_key[round]);
+            present_bitslice_round(p_out, p_in);
+
+            p_swap = p_in;
+            p_in   = p_out;
+            p_out  = p_swap;
+        }
+
+        present_bitslice_add_key(p_in, p_ctx->round_key[rounds]);
+        present_bitslice_transpose(p_in);
+
+        for (lane = 0u; lane < PRESENT_BITSLICE_LANES; lane++)
+        {
+            present_store64(&p_dst[lane * PRESENT_CRYPT_SIZE], p_in[lane]);
+        }
+
+        p_dst += PRESENT_BITSLICE_LANES * PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_BITSLICE_LANES * PRESENT_CRYPT_SIZE;
+        count -= PRESENT_BITSLICE_LANES;
+    }
+
+    /*
+     * A partial batch costs as much as a whole one. Use a block engine for
+     * the remaining blocks.
+     */
+    present_bitslice_tail_engine()->encrypt(p_ctx, p_dst, p_src, count);
+}  /* present_bitslice_encrypt_kernel() */
+
+static PRESENT_INLINE void
+present_bitslice_decrypt_kernel (present_ctx_t const * p_ctx, \
+                                 uint8_t * p_dst, uint8_t const * p_src, \
+                                 size_t count, uint8_t rounds)
+{
+    uint64_t  state[2u][PRESENT_BITSLICE_LANES];
+    uint64_t *p_in;
+    uint64_t *p_out;
+    uint64_t *p_swap;
+    uint8_t   round;
+    uint8_t   lane;
+
+    while (count >= PRESENT_BITSLICE_LANES)
+    {
+        p_in  = state[0];
+        p_out = state[1];
+
+        for (lane = 0u; lane < PRESENT_BITSLICE_LANES; lane++)
+        {
+            p_in[lane] = present_load64(&p_src[lane * PRESENT_CRYPT_SIZE]);
+        }
+
+        present_bitslice_transpose(p_in);
+        present_bitslice_add_key(p_in, p_ctx->round_key[rounds]);
+
+        /*
+         * Every round writes its output to the other buffer of the state.
+         */
+        for (round = rounds; round > 0u; round--)
+        {
+            present_bitslice_round_inv(p_out, p_in);
+            present_bitslice_add_key(p_out, p_ctx->round_key[round - 1u]);
+
+            p_swap = p_in;
+            p_in   = p_out;
+            p_out  = p_swap;
+        }
+
+        present_bitslice_transpose(p_in);
+
+        for (lane = 0u; lane < PRESENT_BITSLICE_LANES; lane++)
+        {
+            present_store64(&p_dst[lane * PRESENT_CRYPT_SIZE], p_in[lane]);
+        }
+
+        p_dst += PRESENT_BITSLICE_LANES * PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_BITSLICE_LANES * PRESENT_CRYPT_SIZE;
+        count -= PRESENT_BITSLICE_LANES;
+    }
+
+    /*
+     * A partial batch costs as much as a whole one. Use a block engine for
+     * the remaining blocks.
+     */
+    present_bitslice_tail_engine()->decrypt(p_ctx, p_dst, p_src, count);
+}  /* present_bitslice_decrypt_kernel() */
+
+static void
+present_bitslice_encrypt_blocks (present_ctx_t const * p_ctx, \
+                                 uint8_t * p_dst, uint8_t const * p_src, \
+                                 size_t count)
+{
+    ASSERT(NULL != p_ctx);
+
+    PRESENT_ROUND_DISPATCH(present_bitslice_encrypt_kernel, p_ctx, p_dst, \
+                           p_src, count);
+}  /* present_bitslice_encrypt_blocks() */
+
+static void
+present_bitslice_decrypt_blocks (present_ctx_t const * p_ctx, \
+                                 uint8_t * p_dst, uint8_t const * p_src, \
+                                 size_t count)
+{
+    ASSERT(NULL != p_ctx);
+
+    PRESENT_ROUND_DISPATCH(present_bitslice_decrypt_kernel, p_ctx, p_dst, \
+                           p_src, count);
+}  /* present_bitslice_decrypt_blocks() */
+
+/*** END OF FILE ***/
@@ -0,0 +1,520 @@
+/**
+ * @file present_cache.c
+ * @brief Source file of the PRESENT expanded key cache.
+ *
+ * The file is the C implementation of the PRESENT expanded key cache. The
+ * file contains global and static function definitions, data structures,
+ * type definitions, etc, of the module.
+ *
+ * The synchronization is built on the GCC atomic builtins, since the
+ * project is compiled as C99 which has no atomic types.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_cache.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_CACHE)
+
+#if CONF_PRESENT_CACHE
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <string.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <assert.h>
+#include <cpu.h>
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Offset basis and prime of the 32-bit FNV-1a hash.
+ */
+#define PRESENT_CACHE_FNV_BASIS (2166136261ul)
+#define PRESENT_CACHE_FNV_PRIME (16777619ul)
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if !defined(__GNUC__)
+#   error "Key cache requires the GCC atomic builtins!"
+#endif
+
+#if (PRESENT_CACHE_WAYS < 1u)
+#   error "Cache set must have a slot at least!"
+#endif
+
+#if (PRESENT_CACHE_WAYS > 255u)
+#   error "CLOCK hand could not point at all the slots of a set!"
+#endif
+
+/*****************************************************************************/
+/* GLOBAL VARIABLES                                                          */
+/*****************************************************************************/
+
+/**
+ * Counter index of the calling thread plus one. It is zero until the
+ * thread makes its first lookup.
+ */
+static __thread unsigned int g_cache_counter = 0u;
+
+/**
+ * Counter index of the next thread that makes its first lookup.
+ */
+static unsigned int g_cache_next_counter = 0u;
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Gets the lookup counter of the calling thread.
+ *
+ * The function gives the counters of the cache to the threads in turn, so
+ * that the threads write different lines as long as they are not more
+ * than the counters.
+ *
+ * @param[in,out] p_cache Pointer of the cache.
+ *
+ * @return Pointer of the counter.
+ */
+static present_cache_counter_t *
+present_cache_counter(present_cache_t * p_cache);
+
+/**
+ * @brief Hashes the key.
+ *
+ * The function computes the FNV-1a hash of \p p_key and \p key_size.
+ *
+ * @param[in] p_key    Pointer of the crypt key.
+ * @param[in] key_size Size of the key in byte.
+ *
+ * @return The hash value.
+ */
+static unsigned long
+present_cache_hash(uint8_t const * p_key, size_t key_size);
+
+/**
+ * @brief Compares the key with the key of a slot.
+ *
+ * The function compares all the bytes of the keys regardless of the first
+ * difference, so that the comparison time does not leak the key.
+ *
+ * @param[in] p_slot   Pointer of the slot.
+ * @param[in] p_key    Pointer of the crypt key.
+ * @param[in] key_size Size of the key in byte.
+ *
+ * @return True if the slot holds the key, false otherwise.
+ */
+static bool
+present_cache_match(present_cache_slot_t const * p_slot, \
+                    uint8_t const * p_key, size_t key_size);
+
+/**
+ * @brief Copies the context of a slot.
+ *
+ * The function copies the context pointed by \p p_src word by word with
+ * relaxed atomic loads, since a writer could change it during the copy. A
+ * torn copy is detected by the sequence counter of the slot.
+ *
+ * @param[out] p_dst Pointer of the copied context.
+ * @param[in]  p_src Pointer of the context of the slot.
+ *
+ * @return None.
+ */
+static void
+present_cache_load_ctx(present_ctx_t * p_dst, present_ctx_t const * p_src);
+
+/**
+ * @brief Writes the context of a slot.
+ *
+ * The function copies the context pointed by \p p_src to the context of
+ * a slot pointed by \p p_dst word by word with relaxed atomic stores, so
+ * that the concurrent readers never see a partial word.
+ *
+ * @param[out] p_dst Pointer of the context of the slot.
+ * @param[in]  p_src Pointer of the context.
+ *
+ * @return None.
+ */
+static void
+present_cache_store_ctx(present_ctx_t * p_dst, present_ctx_t const * p_src);
+
+/**
+ * @brief Searches the key in a set without locking.
+ *
+ * The function copies the context of the key to \p p_ctx if a slot of the
+ * set pointed by \p p_set holds the key. A slot that is written during the
+ * read is read again.
+ *
+ * @param[in]  p_set    Pointer of the first slot of the set.
+ * @param[in]  p_key    Pointer of the crypt key.
+ * @param[in]  key_size Size of the key in byte.
+ * @param[out] p_ctx    Pointer of the crypt context.
+ *
+ * @return True if the key is found, false otherwise.
+ */
+static bool
+present_cache_lookup(present_cache_slot_t * p_set, uint8_t const * p_key, \
+                     size_t key_size, present_ctx_t * p_ctx);
+
+/**
+ * @brief Inserts the expanded key into a set.
+ *
+ * The function stores the key and its context into a slot of the set
+ * pointed by \p p_set. If the set is full, the CLOCK algorithm chooses the
+ * slot to evict, starting from the hand of the set. The caller must hold
+ * the insertion lock of the set.
+ *
+ * @param[in,out] p_set    Pointer of the first slot of the set.
+ * @param[in]     p_key    Pointer of the crypt key.
+ * @param[in]     key_size Size of the key in byte.
+ * @param[in]     p_ctx    Pointer of the crypt context.
+ *
+ * @return None.
+ */
+static void
+present_cache_insert(present_cache_slot_t * p_set, uint8_t const * p_key, \
+                     size_t key_size, present_ctx_t const * p_ctx);
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+void
+present_cache_init (present_cache_t * p_cache, \
+                    present_cache_slot_t * p_slots, size_t slot_count)
+{
+    ASSERT(NULL != p_cache);
+    ASSERT(NULL != p_slots);
+    ASSERT(slot_count >= PRESENT_CACHE_WAYS);
+
+    memset(p_slots, 0, slot_count * sizeof(p_slots[0]));
+    memset(p_cache->counters, 0, sizeof(p_cache->counters));
+
+    p_cache->p_slots   = p_slots;
+    p_cache->set_count = slot_count / PRESENT_CACHE_WAYS;
+}  /* present_cache_init() */
+
+bool
+present_cache_get (present_cache_t * p_cache, uint8_t const * p_key, \
+                   size_t key_size, present_ctx_t * p_ctx)
+{
+    present_cache_slot_t * p_set;
+    unsigned int           spins = 0u;
+
+    ASSERT(NULL != p_cache);
+    ASSERT(NULL != p_key);
+    ASSERT(NULL != p_ctx);
+
+    if ((PRESENT_KEY80_SIZE != key_size) && (PRESENT_KEY128_SIZE != key_size))
+    {
+        return false;
+    }
+
+    p_set = &p_cache->p_slots[(present_cache_hash(p_key, key_size) \
+                               % p_cache->set_count) * PRESENT_CACHE_WAYS];
+
+    if (present_cache_lookup(p_set, p_key, key_size, p_ctx))
+    {
+        __atomic_fetch_add(&present_cache_counter(p_cache)->hits, 1ul, \
+                           __ATOMIC_RELAXED);
+        return true;
+    }
+
+    __atomic_fetch_add(&present_cache_counter(p_cache)->misses, 1ul, \
+                       __ATOMIC_RELAXED);
+
+    /*
+     * Expand the key before taking the lock, so that the other misses are
+     * not blocked by the key schedule.
+     */
+    (void)present_key_setup(p_ctx, p_key, key_size);
+
+    /*
+     * Only the insertions into the same set wait here. The lookups never
+     * take the lock. A waiter yields the CPU after a while, in case that
+     * the lock holder was preempted.
+     */
+    while (__atomic_test_and_set(&p_set[0].lock, __ATOMIC_ACQUIRE))
+    {
+        while (__atomic_load_n(&p_set[0].lock, __ATOMIC_RELAXED))
+        {
+            cpu_spin(&spins);
+        }
+    }
+
+    /*
+     * Another thread could have inserted the same key while the key was
+     * expanded.
+     */
+    if (!present_cache_lookup(p_set, p_key, key_size, p_ctx))
+    {
+        present_cache_insert(p_set, p_key, key_size, p_ctx);
+    }
+
+    __atomic_clear(&p_set[0].lock, __ATOMIC_RELEASE);
+
+    return true;
+}  /* present_cache_get() */
+
+void
+present_cache_stats (present_cache_t const * p_cache, \
+                     unsigned long * p_hits, unsigned long * p_misses)
+{
+    size_t counter;
+
+    ASSERT(NULL != p_cache);
+    ASSERT(NULL != p_hits);
+    ASSERT(NULL != p_misses);
+
+    *p_hits   = 0u;
+    *p_misses = 0u;
+
+    for (counter = 0u; counter < PRESENT_CACHE_STRIPES; counter++)
+    {
+        *p_hits   += __atomic_load_n(&p_cache->counters[counter].hits, \
+                                     __ATOMIC_RELAXED);
+        *p_misses += __atomic_load_n(&p_cache->counters[counter].misses, \
+                                     __ATOMIC_RELAXED);
+    }
+}  /* present_cache_stats() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static present_cache_counter_t *
+present_cache_counter (present_cache_t * p_cache)
+{
+    if (0u == g_cache_counter)
+    {
+        g_cache_counter = (__atomic_fetch_add(&g_cache_next_counter, 1u, \
+                                              __ATOMIC_RELAXED) \
+                           % PRESENT_CACHE_STRIPES) + 1u;
+    }
+
+    return &p_cache->counters[g_cache_counter - 1u];
+}  /* present_cache_counter() */
+
+static unsigned long
+present_cache_hash (uint8_t const * p_key, size_t key_size)
+{
+    unsigned long hash = PRESENT_CACHE_FNV_BASIS ^ (unsigned long)key_size;
+    size_t        byte;
+
+    for (byte = 0u; byte < key_size; byte++)
+    {
+        hash = ((hash ^ p_key[byte]) * PRESENT_CACHE_FNV_PRIME) \
+               & 0xFFFFFFFFul;
+    }
+
+    return hash;
+}  /* present_cache_hash() */
+
+static bool
+present_cache_match (present_cache_slot_t const * p_slot, \
+                     uint8_t const * p_key, size_t key_size)
+{
+    uint8_t diff = 0u;
+    size_t  byte;
+
+    /*
+     * A writer could change the slot during the comparison. The loads are
+     * atomic, and the caller discards the result if the slot is written.
+     */
+    if (__atomic_load_n(&p_slot->key_size, __ATOMIC_RELAXED) != key_size)
+    {
+        return false;
+    }
+
+    for (byte = 0u; byte < key_size; byte++)
+    {
+        diff |= __atomic_load_n(&p_slot->key[byte], __ATOMIC_RELAXED) \
+                ^ p_key[byte];
+    }
+
+    return 0u == diff;
+}  /* present_cache_match() */
+
+static void
+present_cache_load_ctx (present_ctx_t * p_dst, present_ctx_t const * p_src)
+{
+    uint8_t round;
+
+    for (round = 0u; round <= PRESENT_ROUND_COUNT_MAX; round++)
+    {
+        p_dst->round_key[round] = __atomic_load_n(&p_src->round_key[round], \
+                                                  __ATOMIC_RELAXED);
+        p_dst->inv_round_key[round] \
+            = __atomic_load_n(&p_src->inv_round_key[round], __ATOMIC_RELAXED);
+    }
+
+    p_dst->rounds = __atomic_load_n(&p_src->rounds, __ATOMIC_RELAXED);
+}  /* present_cache_load_ctx() */
+
+static void
+present_cache_store_ctx (present_ctx_t * p_dst, present_ctx_t const * p_src)
+{
+    uint8_t round;
+
+    for (round = 0u; round <= PRESENT_ROUND_COUNT_MAX; round++)
+    {
+        __atomic_store_n(&p_dst->round_key[round], p_src->round_key[round], \
+                         __ATOMIC_RELAXED);
+        __atomic_store_n(&p_dst->inv_round_key[round], \
+                         p_src->inv_round_key[round], __ATOMIC_RELAXED);
+    }
+
+    __atomic_store_n(&p_dst->rounds, p_src->rounds, __ATOMIC_RELAXED);
+}  /* present_cache_store_ctx() */
+
+static bool
+present_cache_lookup (present_cache_slot_t * p_set, uint8_t const * p_key, \
+                      size_t key_size, present_ctx_t * p_ctx)
+{
+    present_cache_slot_t * p_slot;
+    unsigned int           sequence;
+    bool                   found;
+    uint8_t                way;
+
+    for (way = 0u; way < PRESENT_CACHE_WAYS; way++)
+    {
+        p_slot = &p_set[way];
+
+        do {
+            /*
+             * An odd sequence means that a writer is in the slot.
+             */
+            do {
+                sequence = __atomic_load_n(&p_slot->sequence, \
+                                           __ATOMIC_ACQUIRE);
+            } while (sequence & 1u);
+
+            found = present_cache_match(p_slot, p_key, key_size);
+
+            if (found)
+            {
+                present_cache_load_ctx(p_ctx, &p_slot->ctx);
+            }
+
+            /*
+             * The read is only valid if no writer entered the slot since
+             * the sequence was loaded.
+             */
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        } while (sequence != __atomic_load_n(&p_slot->sequence, \
+                                             __ATOMIC_RELAXED));
+
+        if (found)
+        {
+            /*
+             * Only write the flag if it is clear, so that the hits of a
+             * hot key do not write its line again and again.
+             */
+            if (0u == __atomic_load_n(&p_slot->referenced, __ATOMIC_RELAXED))
+            {
+                __atomic_store_n(&p_slot->referenced, 1u, __ATOMIC_RELAXED);
+            }
+
+            return true;
+        }
+    }
+
+    return false;
+}  /* present_cache_lookup() */
+
+static void
+present_cache_insert (present_cache_slot_t * p_set, uint8_t const * p_key, \
+                      size_t key_size, present_ctx_t const * p_ctx)
+{
+    present_cache_slot_t * p_slot;
+    size_t                 byte;
+    size_t                 step;
+    uint8_t                way = p_set[0].hand;
+
+    /*
+     * Give every referenced slot a second chance by clearing its flag. The
+     * sweep ends at an empty slot or at the first slot that was not
+     * referenced since its last chance. The lookups could set the flags
+     * again during the sweep, so it is limited to two turns, and the slot
+     * under the hand is evicted after them.
+     */
+    for (step = 0u; step < 2u * PRESENT_CACHE_WAYS; step++)
+    {
+        p_slot = &p_set[way];
+
+        if ((0u == p_slot->key_size)
+            || !__atomic_exchange_n(&p_slot->referenced, 0u, \
+                                    __ATOMIC_RELAXED))
+        {
+            break;
+        }
+
+        way = (uint8_t)((way + 1u) % PRESENT_CACHE_WAYS);
+    }
+
+    /*
+     * The next sweep of the set starts after the evicted slot.
+     */
+    p_slot        = &p_set[way];
+    p_set[0].hand = (unsigned char)((way + 1u) % PRESENT_CACHE_WAYS);
+
+    /*
+     * Make the sequence odd before the write and even after it, so that
+     * the readers detect the write.
+     */
+    __atomic_fetch_add(&p_slot->sequence, 1u, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    __atomic_store_n(&p_slot->key_size, (unsigned char)key_size, \
+                     __ATOMIC_RELAXED);
+
+    for (byte = 0u; byte < key_size; byte++)
+    {
+        __atomic_store_n(&p_slot->key[byte], p_key[byte], __ATOMIC_RELAXED);
+    }
+
+    present_cache_store_ctx(&p_slot->ctx, p_ctx);
+
+    __atomic_fetch_add(&p_slot->sequence, 1u, __ATOMIC_RELEASE);
+}  /* present_cache_insert() */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_cache_unused_t;
+
+#endif  /* CONF_PRESENT_CACHE */
+
+/*** END OF FILE ***/
@@ -0,0 +1,146 @@
+/**
+ * @file present_cbc.c
+ * @brief Source file of the PRESENT cipher block chaining mode.
+ *
+ * The file is the C implementation of the PRESENT cipher block chaining
+ * mode. The file contains global and static function definitions, data
+ * structures, type definitions, etc, of the module.
+ *
+ * The decryption runs the inverse engine on @ref PRESENT_CBC_BATCH blocks
+ * per call, so that its throughput follows the ECB decryption of the
+ * active engine.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_cbc.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_CBC)
+
+#if CONF_PRESENT_CBC
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present_engine.h>
+#include <assert.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if (PRESENT_CBC_BATCH < 1u)
+#   error "Decryption batch must have a block at least!"
+#endif
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+void
+present_cbc_encrypt (present_ctx_t const * p_ctx, uint8_t * p_iv, \
+                     uint8_t * p_dst, uint8_t const * p_src, size_t count)
+{
+    uint64_t chain;
+
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_iv);
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    chain = present_load64(p_iv);
+
+    while (count > 0u)
+    {
+        present_store64(p_dst, present_load64(p_src) ^ chain);
+        present_ctx_encrypt(p_ctx, p_dst);
+
+        chain = present_load64(p_dst);
+
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+        count--;
+    }
+
+    present_store64(p_iv, chain);
+}  /* present_cbc_encrypt() */
+
+void
+present_cbc_decrypt (present_ctx_t const * p_ctx, uint8_t * p_iv, \
+                     uint8_t * p_dst, uint8_t const * p_src, size_t count)
+{
+    uint8_t  plain[PRESENT_CBC_BATCH * PRESENT_CRYPT_SIZE];
+    uint64_t chain;
+    size_t   batch;
+    size_t   block;
+    size_t   offset;
+
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_iv);
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    while (count > 0u)
+    {
+        batch = (count < PRESENT_CBC_BATCH) ? count : PRESENT_CBC_BATCH;
+
+        present_decrypt_blocks(p_ctx, plain, p_src, batch);
+
+        /*
+         * Save the chain of the next batch before the buffers are written,
+         * since they could be the same.
+         */
+        chain = present_load64(&p_src[(batch - 1u) * PRESENT_CRYPT_SIZE]);
+
+        /*
+         * XOR from the last block, so that every crypted block is read
+         * before its place is written.
+         */
+        for (block = batch - 1u; block > 0u; block--)
+        {
+            offset = block * PRESENT_CRYPT_SIZE;
+
+            present_store64(&p_dst[offset], present_load64(&plain[offset]) \
+                            ^ present_load64(&p_src[offset \
+                                                    - PRESENT_CRYPT_SIZE]));
+        }
+
+        present_store64(p_dst, present_load64(plain) ^ present_load64(p_iv));
+        present_store64(p_iv, chain);
+
+        p_dst += batch * PRESENT_CRYPT_SIZE;
+        p_src += batch * PRESENT_CRYPT_SIZE;
+        count -= batch;
+    }
+}  /* present_cbc_decrypt() */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_cbc_unused_t;
+
+#endif  /* CONF_PRESENT_CBC */
+
+/*** END OF FILE ***/
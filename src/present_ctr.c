@@ -0,0 +1,310 @@
+/**
+ * @file present_ctr.c
+ * @brief Source file of the PRESENT counter mode.
+ *
+ * The file is the C implementation of the PRESENT counter mode. The file
+ * contains global and static function definitions, data structures, type
+ * definitions, etc, of the module.
+ *
+ * The counter blocks of @ref PRESENT_CTR_BATCH blocks are written into a
+ * buffer and encrypted by a single call of the active engine, so that the
+ * parallel engines get enough blocks to fill their lanes. The keystream is
+ * XORed with the message a vector register at a time.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_ctr.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_CTR)
+
+#if CONF_PRESENT_CTR
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#   include <emmintrin.h>
+#endif  /* __SSE2__ */
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present_engine.h>
+#include <assert.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if (PRESENT_CTR_BATCH < 1u)
+#   error "Keystream batch must have a block at least!"
+#endif
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Generates the keystream of consecutive counters.
+ *
+ * The function writes \p count counter blocks to the buffer pointed by
+ * \p p_stream, encrypts them in place and advances the counter.
+ *
+ * @param[in,out] p_ctr    Pointer of the counter mode state.
+ * @param[out]    p_stream Pointer of the keystream buffer.
+ * @param[in]     count    Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_ctr_keystream(present_ctr_t * p_ctr, uint8_t * p_stream, \
+                      size_t count);
+
+/**
+ * @brief XORs the buffer with the keystream.
+ *
+ * The function XORs \p size bytes of \p p_src with \p p_stream and writes
+ * the result to \p p_dst.
+ *
+ * @param[out] p_dst    Pointer of the output buffer.
+ * @param[in]  p_src    Pointer of the input buffer.
+ * @param[in]  p_stream Pointer of the keystream buffer.
+ * @param[in]  size     Size of the buffers in byte.
+ *
+ * @return None.
+ */
+static void
+present_ctr_xor(uint8_t * p_dst, uint8_t const * p_src, \
+                uint8_t const * p_stream, size_t size);
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+bool
+present_ctr_init (present_ctr_t * p_ctr, present_ctx_t const * p_ctx, \
+                  uint8_t const * p_iv, uint8_t counter_bits)
+{
+    uint64_t block;
+
+    ASSERT(NULL != p_ctr);
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_iv);
+
+    if ((counter_bits < 1u) || (counter_bits > PRESENT_CRYPT_BIT_SIZE))
+    {
+        return false;
+    }
+
+    block = present_load64(p_iv);
+
+    /*
+     * Shift in two steps, since a shift by the word size is undefined.
+     */
+    p_ctr->p_ctx        = p_ctx;
+    p_ctr->counter_mask = ~((~UINT64_C(0) << (counter_bits - 1u)) << 1u);
+    p_ctr->nonce        = block & ~p_ctr->counter_mask;
+    p_ctr->counter      = block & p_ctr->counter_mask;
+    p_ctr->used         = PRESENT_CRYPT_SIZE;
+
+    /*
+     * A counter of n bits has 2^n blocks. The 64-bit counter is limited to
+     * 2^64 - 1 blocks, which is still far more than could be processed.
+     */
+    p_ctr->remaining = p_ctr->counter_mask;
+
+    if (counter_bits < PRESENT_CRYPT_BIT_SIZE)
+    {
+        p_ctr->remaining++;
+    }
+
+    return true;
+}  /* present_ctr_init() */
+
+bool
+present_ctr_check (present_ctr_t const * p_ctr, size_t size)
+{
+    size_t left;
+
+    ASSERT(NULL != p_ctr);
+
+    /*
+     * The rest of the keystream of the last block needs no new block.
+     */
+    left = PRESENT_CRYPT_SIZE - p_ctr->used;
+
+    if (size <= left)
+    {
+        return true;
+    }
+
+    return (size - left - 1u) / PRESENT_CRYPT_SIZE < p_ctr->remaining;
+}  /* present_ctr_check() */
+
+bool
+present_ctr_crypt (present_ctr_t * p_ctr, uint8_t * p_dst, \
+                   uint8_t const * p_src, size_t size)
+{
+    uint8_t stream[PRESENT_CTR_BATCH * PRESENT_CRYPT_SIZE];
+    size_t  part;
+
+    ASSERT(NULL != p_ctr);
+    ASSERT((NULL != p_dst) || (0u == size));
+    ASSERT((NULL != p_src) || (0u == size));
+
+    if (!present_ctr_check(p_ctr, size))
+    {
+        return false;
+    }
+
+    /*
+     * Use the rest of the keystream of the previous call first.
+     */
+    part = PRESENT_CRYPT_SIZE - p_ctr->used;
+    part = (part < size) ? part : size;
+
+    present_ctr_xor(p_dst, p_src, &p_ctr->keystream[p_ctr->used], part);
+
+    p_ctr->used = (uint8_t)(p_ctr->used + part);
+    p_dst      += part;
+    p_src      += part;
+    size       -= part;
+
+    while (size >= PRESENT_CRYPT_SIZE)
+    {
+        part = size / PRESENT_CRYPT_SIZE;
+        part = (part < PRESENT_CTR_BATCH) ? part : PRESENT_CTR_BATCH;
+
+        present_ctr_keystream(p_ctr, stream, part);
+
+        part *= PRESENT_CRYPT_SIZE;
+
+        present_ctr_xor(p_dst, p_src, stream, part);
+
+        p_dst += part;
+        p_src += part;
+        size  -= part;
+    }
+
+    /*
+     * Keep the keystream of the last partial block for the next call.
+     */
+    if (size > 0u)
+    {
+        present_ctr_keystream(p_ctr, p_ctr->keystream, 1u);
+        present_ctr_xor(p_dst, p_src, p_ctr->keystream, size);
+
+        p_ctr->used = (uint8_t)size;
+    }
+
+    return true;
+}  /* present_ctr_crypt() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static void
+present_ctr_keystream (present_ctr_t * p_ctr, uint8_t * p_stream, \
+                       size_t count)
+{
+    uint64_t counter = p_ctr->counter;
+    size_t   block;
+
+    for (block = 0u; block < count; block++)
+    {
+        present_store64(&p_stream[block * PRESENT_CRYPT_SIZE], \
+                        p_ctr->nonce | counter);
+
+        counter = (counter + 1u) & p_ctr->counter_mask;
+    }
+
+    p_ctr->counter    = counter;
+    p_ctr->remaining -= count;
+
+    present_encrypt_blocks(p_ctr->p_ctx, p_stream, p_stream, count);
+}  /* present_ctr_keystream() */
+
+static void
+present_ctr_xor (uint8_t * p_dst, uint8_t const * p_src, \
+                 uint8_t const * p_stream, size_t size)
+{
+    uint64_t text;
+    uint64_t stream;
+#if defined(__SSE2__)
+    __m128i  vector;
+#endif  /* __SSE2__ */
+
+#if defined(__SSE2__)
+    while (size >= sizeof(__m128i))
+    {
+        vector = _mm_xor_si128(_mm_loadu_si128((__m128i const *)p_src), \
+                               _mm_loadu_si128((__m128i const *)p_stream));
+        _mm_storeu_si128((__m128i *)p_dst, vector);
+
+        p_dst    += sizeof(__m128i);
+        p_src    += sizeof(__m128i);
+        p_stream += sizeof(__m128i);
+        size     -= sizeof(__m128i);
+    }
+#endif  /* __SSE2__ */
+
+    /*
+     * Copy the words through memcpy, since the buffers have no alignment
+     * requirement.
+     */
+    while (size >= sizeof(uint64_t))
+    {
+        memcpy(&text, p_src, sizeof(text));
+        memcpy(&stream, p_stream, sizeof(stream));
+
+        text ^= stream;
+        memcpy(p_dst, &text, sizeof(text));
+
+        p_dst    += sizeof(uint64_t);
+        p_src    += sizeof(uint64_t);
+        p_stream += sizeof(uint64_t);
+        size     -= sizeof(uint64_t);
+    }
+
+    while (size > 0u)
+    {
+        *p_dst++ = *p_src++ ^ *p_stream++;
+        size--;
+    }
+}  /* present_ctr_xor() */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_ctr_unused_t;
+
+#endif  /* CONF_PRESENT_CTR */
+
+/*** END OF FILE ***/
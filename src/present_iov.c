@@ -0,0 +1,305 @@
+/**
+ * @file present_iov.c
+ * @brief Source file of the PRESENT scatter-gather interface.
+ *
+ * The file is the C implementation of the PRESENT scatter-gather
+ * interface. The file contains global and static function definitions,
+ * data structures, type definitions, etc, of the module.
+ *
+ * The chains are walked by cursors. Every step passes the longest part of
+ * the current input buffer whose output fits into the current output
+ * buffer to the stream mode. Only when the output buffer has no room for a
+ * whole block, the output goes through a block sized bounce buffer.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_iov.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_IOV)
+
+#if CONF_PRESENT_IOV
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <string.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <assert.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if !CONF_PRESENT_CTR || !CONF_PRESENT_STREAM
+#   error "Scatter-gather interface requires the stream mode modules!"
+#endif
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * @brief Buffer chain cursor type.
+ *
+ * This type holds the position of a walk on a buffer chain.
+ */
+typedef struct {
+    /*! Pointer of the buffer chain. */
+    struct iovec const * p_iov;
+    /*! Count of the buffers. */
+    size_t               count;
+    /*! Index of the current buffer. */
+    size_t               index;
+    /*! Offset in the current buffer. */
+    size_t               offset;
+} present_iov_cursor_t;
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Gets the room of the current buffer.
+ *
+ * The function skips the empty buffers and returns the count of the bytes
+ * from the cursor to the end of the current buffer.
+ *
+ * @param[in,out] p_cursor Pointer of the cursor.
+ *
+ * @return The room in byte, or zero at the end of the chain.
+ */
+static size_t
+present_iov_room(present_iov_cursor_t * p_cursor);
+
+/**
+ * @brief Gets the address of the cursor.
+ *
+ * @param[in] p_cursor Pointer of the cursor.
+ *
+ * @return Pointer of the byte at the cursor.
+ */
+static uint8_t *
+present_iov_ptr(present_iov_cursor_t const * p_cursor);
+
+/**
+ * @brief Writes bytes to the chain.
+ *
+ * The function copies \p size bytes of \p p_src to the chain and advances
+ * the cursor. The bytes could be spread over several buffers.
+ *
+ * @param[in,out] p_cursor Pointer of the cursor.
+ * @param[in]     p_src    Pointer of the bytes.
+ * @param[in]     size     Count of the bytes.
+ *
+ * @return None.
+ */
+static void
+present_iov_write(present_iov_cursor_t * p_cursor, uint8_t const * p_src, \
+                  size_t size);
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+bool
+present_ctr_crypt_iov (present_ctr_t * p_ctr, struct iovec const * p_dst, \
+                       size_t dst_count, struct iovec const * p_src, \
+                       size_t src_count)
+{
+    present_iov_cursor_t dst  = {NULL, 0u, 0u, 0u};
+    present_iov_cursor_t src  = {NULL, 0u, 0u, 0u};
+    size_t               size = 0u;
+    size_t               room;
+    size_t               part;
+
+    ASSERT(NULL != p_ctr);
+    ASSERT((NULL != p_dst) || (0u == dst_count));
+    ASSERT((NULL != p_src) || (0u == src_count));
+
+    /*
+     * Check the whole chain first, since it is processed in parts.
+     */
+    for (part = 0u; part < src_count; part++)
+    {
+        size += p_src[part].iov_len;
+    }
+
+    if (!present_ctr_check(p_ctr, size))
+    {
+        return false;
+    }
+
+    dst.p_iov = p_dst;
+    dst.count = dst_count;
+    src.p_iov = p_src;
+    src.count = src_count;
+
+    /*
+     * The counter mode maps every input byte to an output byte, so a part
+     * is bounded by both buffers.
+     */
+    while ((part = present_iov_room(&src)) > 0u)
+    {
+        room = present_iov_room(&dst);
+        ASSERT(room > 0u);
+
+        part = (part < room) ? part : room;
+
+        (void)present_ctr_crypt(p_ctr, present_iov_ptr(&dst), \
+                                present_iov_ptr(&src), part);
+
+        dst.offset += part;
+        src.offset += part;
+    }
+
+    return true;
+}  /* present_ctr_crypt_iov() */
+
+size_t
+present_stream_update_iov (present_stream_t * p_stream, \
+                           struct iovec const * p_dst, size_t dst_count, \
+                           struct iovec const * p_src, size_t src_count)
+{
+    present_iov_cursor_t dst     = {NULL, 0u, 0u, 0u};
+    present_iov_cursor_t src     = {NULL, 0u, 0u, 0u};
+    uint8_t              bounce[PRESENT_CRYPT_SIZE];
+    size_t               written = 0u;
+    size_t               output;
+    size_t               limit;
+    size_t               room;
+    size_t               part;
+
+    ASSERT(NULL != p_stream);
+    ASSERT((NULL != p_dst) || (0u == dst_count));
+    ASSERT((NULL != p_src) || (0u == src_count));
+
+    dst.p_iov = p_dst;
+    dst.count = dst_count;
+    src.p_iov = p_src;
+    src.count = src_count;
+
+    while ((part = present_iov_room(&src)) > 0u)
+    {
+        room = present_iov_room(&dst);
+
+        /*
+         * An update writes the whole blocks of the buffered and the new
+         * bytes, so the part is limited to fill the room at most. Without
+         * room for a block, a single block is written to the bounce buffer.
+         */
+        if (room >= PRESENT_CRYPT_SIZE)
+        {
+            limit = room - room % PRESENT_CRYPT_SIZE;
+        }
+        else
+        {
+            limit = PRESENT_CRYPT_SIZE;
+        }
+
+        limit += PRESENT_CRYPT_SIZE - 1u - p_stream->buffered;
+        part   = (part < limit) ? part : limit;
+
+        if (room >= PRESENT_CRYPT_SIZE)
+        {
+            output = present_stream_update(p_stream, present_iov_ptr(&dst), \
+                                           present_iov_ptr(&src), part);
+            dst.offset += output;
+        }
+        else
+        {
+            output = present_stream_update(p_stream, bounce, \
+                                           present_iov_ptr(&src), part);
+            present_iov_write(&dst, bounce, output);
+        }
+
+        src.offset += part;
+        written    += output;
+    }
+
+    return written;
+}  /* present_stream_update_iov() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static size_t
+present_iov_room (present_iov_cursor_t * p_cursor)
+{
+    while ((p_cursor->index < p_cursor->count)
+           && (p_cursor->offset == p_cursor->p_iov[p_cursor->index].iov_len))
+    {
+        p_cursor->index++;
+        p_cursor->offset = 0u;
+    }
+
+    if (p_cursor->index == p_cursor->count)
+    {
+        return 0u;
+    }
+
+    return p_cursor->p_iov[p_cursor->index].iov_len - p_cursor->offset;
+}  /* present_iov_room() */
+
+static uint8_t *
+present_iov_ptr (present_iov_cursor_t const * p_cursor)
+{
+    return (uint8_t *)p_cursor->p_iov[p_cursor->index].iov_base \
+           + p_cursor->offset;
+}  /* present_iov_ptr() */
+
+static void
+present_iov_write (present_iov_cursor_t * p_cursor, uint8_t const * p_src, \
+                   size_t size)
+{
+    size_t part;
+
+    while (size > 0u)
+    {
+        part = present_iov_room(p_cursor);
+        ASSERT(part > 0u);
+
+        part = (part < size) ? part : size;
+        memcpy(present_iov_ptr(p_cursor), p_src, part);
+
+        p_cursor->offset += part;
+        p_src            += part;
+        size             -= part;
+    }
+}  /* present_iov_write() */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_iov_unused_t;
+
+#endif  /* CONF_PRESENT_IOV */
+
+/*** END OF FILE ***/
@@ -0,0 +1,262 @@
+/**
+ * @file present_mb.c
+ * @brief Source file of the PRESENT multi-buffer manager.
+ *
+ * The file is the C implementation of the PRESENT multi-buffer manager.
+ * The file contains global and static function definitions, data
+ * structures, type definitions, etc, of the module.
+ *
+ * Every step gathers the next block of all busy lanes into a buffer, XORs
+ * it with the chain of its lane and encrypts the buffer by a single call of
+ * the active engine. The manager runs as many steps as the shortest job
+ * needs at once, so that the lanes are not checked after every step.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_mb.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_MB)
+
+#if CONF_PRESENT_MB
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present_engine.h>
+#include <assert.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if (PRESENT_MB_LANES < 1u)
+#   error "Multi-buffer manager must have a lane at least!"
+#endif
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Removes a done job from its lane.
+ *
+ * The function frees the lane of the first job that has no block left.
+ *
+ * @param[in,out] p_mgr Pointer of the manager.
+ *
+ * @return Pointer of the done job, or NULL if no job is done.
+ */
+static present_mb_job_t *
+present_mb_take_done(present_mb_mgr_t * p_mgr);
+
+/**
+ * @brief Advances the jobs in the lanes.
+ *
+ * The function processes the blocks of all busy lanes in lockstep until
+ * the shortest job is done.
+ *
+ * @param[in,out] p_mgr Pointer of the manager.
+ *
+ * @return None.
+ */
+static void
+present_mb_run(present_mb_mgr_t * p_mgr);
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+void
+present_mb_init (present_mb_mgr_t * p_mgr, present_ctx_t const * p_ctx)
+{
+    size_t lane;
+
+    ASSERT(NULL != p_mgr);
+    ASSERT(NULL != p_ctx);
+
+    p_mgr->p_ctx = p_ctx;
+    p_mgr->busy  = 0u;
+
+    for (lane = 0u; lane < PRESENT_MB_LANES; lane++)
+    {
+        p_mgr->p_jobs[lane] = NULL;
+        p_mgr->done[lane]   = 0u;
+    }
+}  /* present_mb_init() */
+
+present_mb_job_t *
+present_mb_submit (present_mb_mgr_t * p_mgr, present_mb_job_t * p_job)
+{
+    present_mb_job_t * p_done;
+    size_t             lane;
+
+    ASSERT(NULL != p_mgr);
+    ASSERT(NULL != p_job);
+    ASSERT((NULL != p_job->p_src) || (0u == p_job->count));
+    ASSERT(p_mgr->busy < PRESENT_MB_LANES);
+
+    for (lane = 0u; NULL != p_mgr->p_jobs[lane]; lane++)
+    {
+        /*
+         * Search the free lane.
+         */
+    }
+
+    p_mgr->p_jobs[lane] = p_job;
+    p_mgr->done[lane]   = 0u;
+    p_mgr->busy++;
+
+    /*
+     * A job without blocks is done as soon as it is submitted.
+     */
+    p_done = present_mb_take_done(p_mgr);
+
+    if ((NULL == p_done) && (PRESENT_MB_LANES == p_mgr->busy))
+    {
+        present_mb_run(p_mgr);
+        p_done = present_mb_take_done(p_mgr);
+    }
+
+    return p_done;
+}  /* present_mb_submit() */
+
+present_mb_job_t *
+present_mb_flush (present_mb_mgr_t * p_mgr)
+{
+    present_mb_job_t * p_done;
+
+    ASSERT(NULL != p_mgr);
+
+    p_done = present_mb_take_done(p_mgr);
+
+    if ((NULL == p_done) && (p_mgr->busy > 0u))
+    {
+        present_mb_run(p_mgr);
+        p_done = present_mb_take_done(p_mgr);
+    }
+
+    return p_done;
+}  /* present_mb_flush() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static present_mb_job_t *
+present_mb_take_done (present_mb_mgr_t * p_mgr)
+{
+    present_mb_job_t * p_job;
+    size_t             lane;
+
+    for (lane = 0u; lane < PRESENT_MB_LANES; lane++)
+    {
+        p_job = p_mgr->p_jobs[lane];
+
+        if ((NULL != p_job) && (p_mgr->done[lane] == p_job->count))
+        {
+            p_mgr->p_jobs[lane] = NULL;
+            p_mgr->busy--;
+
+            return p_job;
+        }
+    }
+
+    return NULL;
+}  /* present_mb_take_done() */
+
+static void
+present_mb_run (present_mb_mgr_t * p_mgr)
+{
+    uint8_t            buffer[PRESENT_MB_LANES * PRESENT_CRYPT_SIZE];
+    present_mb_job_t * p_jobs[PRESENT_MB_LANES];
+    size_t             lanes[PRESENT_MB_LANES];
+    present_mb_job_t * p_job;
+    size_t             count = 0u;
+    size_t             steps = SIZE_MAX;
+    size_t             offset;
+    size_t             lane;
+    size_t             slot;
+
+    /*
+     * Pack the busy lanes, so that the engine gets consecutive blocks.
+     */
+    for (lane = 0u; lane < PRESENT_MB_LANES; lane++)
+    {
+        p_job = p_mgr->p_jobs[lane];
+
+        if (NULL != p_job)
+        {
+            p_jobs[count] = p_job;
+            lanes[count]  = lane;
+            count++;
+
+            if (p_job->count - p_mgr->done[lane] < steps)
+            {
+                steps = p_job->count - p_mgr->done[lane];
+            }
+        }
+    }
+
+    for (; steps > 0u; steps--)
+    {
+        for (slot = 0u; slot < count; slot++)
+        {
+            offset = p_mgr->done[lanes[slot]] * PRESENT_CRYPT_SIZE;
+
+            present_store64(&buffer[slot * PRESENT_CRYPT_SIZE], \
+                            present_load64(&p_jobs[slot]->p_src[offset]) \
+                            ^ present_load64(p_jobs[slot]->chain));
+        }
+
+        present_encrypt_blocks(p_mgr->p_ctx, buffer, buffer, count);
+
+        for (slot = 0u; slot < count; slot++)
+        {
+            p_job  = p_jobs[slot];
+            offset = slot * PRESENT_CRYPT_SIZE;
+
+            present_store64(p_job->chain, present_load64(&buffer[offset]));
+
+            if (NULL != p_job->p_dst)
+            {
+                offset = p_mgr->done[lanes[slot]] * PRESENT_CRYPT_SIZE;
+                present_store64(&p_job->p_dst[offset], \
+                                present_load64(p_job->chain));
+            }
+
+            p_mgr->done[lanes[slot]]++;
+        }
+    }
+}  /* present_mb_run() */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_mb_unused_t;
+
+#endif  /* CONF_PRESENT_MB */
+
+/*** END OF FILE ***/
@@ -0,0 +1,479 @@
+/**
+ * @file present_numa.c
+ * @brief Source file of the PRESENT NUMA support.
+ *
+ * The file is the C implementation of the PRESENT NUMA support. The file
+ * contains global and static function definitions, data structures, type
+ * definitions, etc, of the module.
+ *
+ * The system calls are made by their numbers, since the wrappers of the
+ * move_pages call belong to libnuma. The pages are handled in batches, so
+ * that the address and the status arrays stay on the stack.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+
+/*
+ * The system calls, the huge page flags and the CPU number of the caller
+ * are GNU extensions.
+ */
+#if !defined(_GNU_SOURCE)
+#   define _GNU_SOURCE
+#endif  /* _GNU_SOURCE */
+
+#include <present_numa.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_NUMA)
+
+#if CONF_PRESENT_NUMA
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#   include <sched.h>
+#   include <sys/mman.h>
+#   include <sys/syscall.h>
+#   include <unistd.h>
+#endif  /* __linux__ */
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <assert.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if (PRESENT_NUMA_NODES_MAX < 1u) || (PRESENT_NUMA_NODES_MAX > 255u)
+#   error "NUMA node count must be between 1 and 255!"
+#endif
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Count of the pages of a system call.
+ */
+#define PRESENT_NUMA_BATCH (256u)
+
+/*
+ * Flag of the move_pages call that moves the pages of the caller only.
+ */
+#define PRESENT_NUMA_MF_MOVE (2)
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+#if defined(__linux__)
+
+/**
+ * @brief Reads the CPU list of a node.
+ *
+ * The function parses a list like "0-3,8-11" and sets the node of the
+ * listed CPUs.
+ *
+ * @param[in,out] p_numa Pointer of the topology.
+ * @param[in]     p_file Pointer of the list file.
+ * @param[in]     node   Index of the node.
+ *
+ * @return True if the list has a CPU.
+ */
+static bool
+present_numa_read_cpus(present_numa_t * p_numa, FILE * p_file, size_t node);
+
+/**
+ * @brief Finds the index of a node.
+ *
+ * @param[in] p_numa Pointer of the topology.
+ * @param[in] id     System ID of the node.
+ *
+ * @return Index of the node, or @ref PRESENT_NUMA_NODES_MAX if the node has
+ *         no CPU or the ID is not a node.
+ */
+static size_t
+present_numa_index(present_numa_t const * p_numa, int id);
+
+#endif  /* __linux__ */
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+bool
+present_numa_init (present_numa_t * p_numa)
+{
+#if defined(__linux__)
+    char   path[64];
+    FILE * p_file;
+    int    id;
+#endif  /* __linux__ */
+
+    ASSERT(NULL != p_numa);
+
+    memset(p_numa, 0, sizeof(*p_numa));
+
+#if defined(__linux__)
+    for (id = 0; (id < (int)PRESENT_NUMA_NODES_MAX)
+                 && (p_numa->node_count < PRESENT_NUMA_NODES_MAX); id++)
+    {
+        sprintf(path, "/sys/devices/system/node/node%d/cpulist", id);
+
+        if (NULL == (p_file = fopen(path, "r")))
+        {
+            continue;
+        }
+
+        /*
+         * The nodes of memory only get no index, since no worker runs on
+         * them.
+         */
+        if (present_numa_read_cpus(p_numa, p_file, p_numa->node_count))
+        {
+            p_numa->nodes[p_numa->node_count++] = id;
+        }
+
+        fclose(p_file);
+    }
+#endif  /* __linux__ */
+
+    if (0u == p_numa->node_count)
+    {
+        memset(p_numa->cpu_nodes, 0, sizeof(p_numa->cpu_nodes));
+        p_numa->node_count = 1u;
+        return false;
+    }
+
+    return true;
+}  /* present_numa_init() */
+
+size_t
+present_numa_current (present_numa_t const * p_numa)
+{
+#if defined(__linux__)
+    int cpu = sched_getcpu();
+#endif  /* __linux__ */
+
+    ASSERT(NULL != p_numa);
+
+#if defined(__linux__)
+    if ((cpu >= 0) && ((unsigned)cpu < PRESENT_NUMA_CPUS_MAX))
+    {
+        return p_numa->cpu_nodes[cpu];
+    }
+#endif  /* __linux__ */
+
+    return 0u;
+}  /* present_numa_current() */
+
+bool
+present_numa_query (present_numa_t const * p_numa, \
+                    void const * const * pp_addrs, size_t * p_nodes, \
+                    size_t count)
+{
+#if defined(__linux__)
+    void * pages[PRESENT_NUMA_BATCH];
+    int    status[PRESENT_NUMA_BATCH];
+    size_t part;
+    size_t page;
+#endif  /* __linux__ */
+    size_t entry;
+
+    ASSERT(NULL != p_numa);
+    ASSERT((NULL != pp_addrs) || (0u == count));
+    ASSERT((NULL != p_nodes) || (0u == count));
+
+#if defined(__linux__)
+    for (entry = 0u; entry < count; entry += part)
+    {
+        part = count - entry;
+        part = (part < PRESENT_NUMA_BATCH) ? part : PRESENT_NUMA_BATCH;
+
+        for (page = 0u; page < part; page++)
+        {
+            pages[page] = (void *)(uintptr_t)pp_addrs[entry + page];
+        }
+
+        /*
+         * Without the target nodes, the call only reports the nodes.
+         */
+        if (0 != syscall(SYS_move_pages, 0, (unsigned long)part, pages, \
+                         NULL, status, 0))
+        {
+            break;
+        }
+
+        for (page = 0u; page < part; page++)
+        {
+            p_nodes[entry + page] = present_numa_index(p_numa, status[page]);
+        }
+    }
+
+    if (entry >= count)
+    {
+        return true;
+    }
+#endif  /* __linux__ */
+
+    for (entry = 0u; entry < count; entry++)
+    {
+        p_nodes[entry] = PRESENT_NUMA_NODES_MAX;
+    }
+
+    return false;
+}  /* present_numa_query() */
+
+bool
+present_numa_place (present_numa_t const * p_numa, void * p_addr, \
+                    size_t size, bool interleave)
+{
+#if defined(__linux__)
+    void *    pages[PRESENT_NUMA_BATCH];
+    int       targets[PRESENT_NUMA_BATCH];
+    int       status[PRESENT_NUMA_BATCH];
+    uint8_t * p_byte    = (uint8_t *)p_addr;
+    long      page_size = sysconf(_SC_PAGESIZE);
+    size_t    slice;
+    size_t    offset    = 0u;
+    size_t    node;
+    size_t    page;
+    bool      moved     = true;
+#endif  /* __linux__ */
+
+    ASSERT(NULL != p_numa);
+    ASSERT((NULL != p_addr) || (0u == size));
+
+#if defined(__linux__)
+    if (page_size <= 0)
+    {
+        return false;
+    }
+
+    /*
+     * The slices end at the huge page boundaries, so that a huge page is
+     * never split between two nodes.
+     */
+    slice  = (size + p_numa->node_count - 1u) / p_numa->node_count;
+    slice += PRESENT_NUMA_HUGE_PAGE - 1u;
+    slice -= slice % PRESENT_NUMA_HUGE_PAGE;
+
+    while (offset < size)
+    {
+        for (page = 0u; (page < PRESENT_NUMA_BATCH) && (offset < size);
+             page++)
+        {
+            if (interleave)
+            {
+                node = (offset / (size_t)page_size) % p_numa->node_count;
+            }
+            else
+            {
+                node = offset / slice;
+            }
+
+            pages[page]   = &p_byte[offset];
+            targets[page] = p_numa->nodes[node];
+            offset       += (size_t)page_size;
+        }
+
+        if (0 != syscall(SYS_move_pages, 0, (unsigned long)page, pages, \
+                         targets, status, PRESENT_NUMA_MF_MOVE))
+        {
+            return false;
+        }
+
+        while (page > 0u)
+        {
+            moved = moved && (status[--page] >= 0);
+        }
+    }
+
+    return moved;
+#else
+    (void)interleave;
+
+    return false;
+#endif  /* __linux__ */
+}  /* present_numa_place() */
+
+void *
+present_numa_alloc (size_t size, bool * p_huge)
+{
+#if defined(__linux__)
+    uint8_t * p_map;
+    size_t    head;
+#endif  /* __linux__ */
+
+    if (NULL != p_huge)
+    {
+        *p_huge = false;
+    }
+
+    size += PRESENT_NUMA_HUGE_PAGE - 1u;
+    size -= size % PRESENT_NUMA_HUGE_PAGE;
+
+#if defined(__linux__)
+    p_map = mmap(NULL, size, PROT_READ | PROT_WRITE, \
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+    if (MAP_FAILED != p_map)
+    {
+        if (NULL != p_huge)
+        {
+            *p_huge = true;
+        }
+
+        return p_map;
+    }
+
+    /*
+     * Align the normal pages to a huge page, so that the kernel could
+     * merge them.
+     */
+    p_map = mmap(NULL, size + PRESENT_NUMA_HUGE_PAGE, \
+                 PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (MAP_FAILED == p_map)
+    {
+        return NULL;
+    }
+
+    head = (PRESENT_NUMA_HUGE_PAGE \
+            - (uintptr_t)p_map % PRESENT_NUMA_HUGE_PAGE) \
+           % PRESENT_NUMA_HUGE_PAGE;
+
+    if (head > 0u)
+    {
+        munmap(p_map, head);
+    }
+
+    munmap(&p_map[head + size], PRESENT_NUMA_HUGE_PAGE - head);
+
+#if defined(MADV_HUGEPAGE)
+    madvise(&p_map[head], size, MADV_HUGEPAGE);
+#endif  /* MADV_HUGEPAGE */
+
+    return &p_map[head];
+#else
+    return malloc(size);
+#endif  /* __linux__ */
+}  /* present_numa_alloc() */
+
+void
+present_numa_free (void * p_addr, size_t size)
+{
+    if (NULL == p_addr)
+    {
+        return;
+    }
+
+#if defined(__linux__)
+    size += PRESENT_NUMA_HUGE_PAGE - 1u;
+    size -= size % PRESENT_NUMA_HUGE_PAGE;
+
+    munmap(p_addr, size);
+#else
+    (void)size;
+
+    free(p_addr);
+#endif  /* __linux__ */
+}  /* present_numa_free() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+#if defined(__linux__)
+
+static bool
+present_numa_read_cpus (present_numa_t * p_numa, FILE * p_file, size_t node)
+{
+    unsigned first;
+    unsigned last;
+    unsigned cpu;
+    bool     found = false;
+    int      next;
+
+    while (1 == fscanf(p_file, "%u", &first))
+    {
+        last = first;
+        next = fgetc(p_file);
+
+        if (('-' == next) && (1 == fscanf(p_file, "%u", &last)))
+        {
+            next = fgetc(p_file);
+        }
+
+        for (cpu = first; (cpu <= last) && (cpu < PRESENT_NUMA_CPUS_MAX);
+             cpu++)
+        {
+            p_numa->cpu_nodes[cpu] = (uint8_t)node;
+            found                  = true;
+        }
+
+        if (',' != next)
+        {
+            break;
+        }
+    }
+
+    return found;
+}  /* present_numa_read_cpus() */
+
+static size_t
+present_numa_index (present_numa_t const * p_numa, int id)
+{
+    size_t node;
+
+    for (node = 0u; node < p_numa->node_count; node++)
+    {
+        if (p_numa->nodes[node] == id)
+        {
+            return node;
+        }
+    }
+
+    return PRESENT_NUMA_NODES_MAX;
+}  /* present_numa_index() */
+
+#endif  /* __linux__ */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_numa_unused_t;
+
+#endif  /* CONF_PRESENT_NUMA */
+
+/*** END OF FILE ***/
@@ -0,0 +1,723 @@
+/**
+ * @file present_pool.c
+ * @brief Source file of the PRESENT worker pool.
+ *
+ * The file is the C implementation of the PRESENT worker pool. The file
+ * contains global and static function definitions, data structures, type
+ * definitions, etc, of the module.
+ *
+ * A call publishes its buffers in the pool and wakes as many workers as it
+ * has chunks to share. The threads take the chunks by an atomic counter,
+ * so a slow thread takes fewer chunks instead of delaying the call. A
+ * worker that wakes up after the last ticket is taken goes back to sleep.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+
+/*
+ * The CPU affinity functions are GNU extensions.
+ */
+#if !defined(_GNU_SOURCE)
+#   define _GNU_SOURCE
+#endif  /* _GNU_SOURCE */
+
+#include <present_pool.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_POOL)
+
+#if CONF_PRESENT_POOL
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <sched.h>
+#include <unistd.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <assert.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if (PRESENT_POOL_CHUNK < PRESENT_CRYPT_SIZE) \
+    || (PRESENT_POOL_CHUNK % PRESENT_CRYPT_SIZE)
+#   error "Worker pool chunk must be a multiple of the block size!"
+#endif
+
+#if !CONF_PRESENT_NUMA
+#   error "Worker pool requires the NUMA module!"
+#endif
+
+#if PRESENT_POOL_ROUND < 1u
+#   error "Worker pool round must have a chunk at least!"
+#endif
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Count of the blocks in a chunk.
+ */
+#define PRESENT_POOL_CHUNK_BLOCKS (PRESENT_POOL_CHUNK / PRESENT_CRYPT_SIZE)
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Runs a call on the pool.
+ *
+ * The function splits the blocks of the call into chunks, shares them
+ * with the workers and returns when all the chunks are done.
+ *
+ * @param[in,out] p_pool Pointer of the pool with the call fields set.
+ *
+ * @return None.
+ */
+static void
+present_pool_call(present_pool_t * p_pool);
+
+/**
+ * @brief Sorts the chunks of the round by their node.
+ *
+ * @param[in,out] p_pool Pointer of the pool with the round fields set.
+ *
+ * @return None.
+ */
+static void
+present_pool_sort(present_pool_t * p_pool);
+
+/**
+ * @brief Takes the chunks of the running round until none is left.
+ *
+ * The chunks of the node of the calling thread are taken first.
+ *
+ * @param[in,out] p_pool Pointer of the pool.
+ *
+ * @return None.
+ */
+static void
+present_pool_run(present_pool_t * p_pool);
+
+/**
+ * @brief Processes a chunk of the running call.
+ *
+ * @param[in,out] p_pool Pointer of the pool.
+ * @param[in]     chunk  Index of the chunk in the call.
+ *
+ * @return None.
+ */
+static void
+present_pool_chunk(present_pool_t * p_pool, size_t chunk);
+
+/**
+ * @brief Main function of the worker threads.
+ *
+ * @param[in,out] p_arg Pointer of the pool.
+ *
+ * @return NULL.
+ */
+static void *
+present_pool_worker(void * p_arg);
+
+/**
+ * @brief Stops the first workers of the pool.
+ *
+ * @param[in,out] p_pool Pointer of the pool.
+ * @param[in]     count  Count of the started workers.
+ *
+ * @return None.
+ */
+static void
+present_pool_stop(present_pool_t * p_pool, size_t count);
+
+#if defined(__linux__)
+/**
+ * @brief Binds a worker to a CPU of the process.
+ *
+ * @param[in] thread Thread of the worker.
+ * @param[in] p_cpus Pointer of the CPUs that the process may run on.
+ * @param[in] index  Index of the CPU in the set, which wraps around the
+ *                   count of the CPUs.
+ *
+ * @return True if the worker is bound, false otherwise.
+ */
+static bool
+present_pool_bind(pthread_t thread, cpu_set_t const * p_cpus, size_t index);
+#endif  /* __linux__ */
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+bool
+present_pool_init (present_pool_t * p_pool, size_t threads, \
+                   size_t threshold, bool affinity)
+{
+    long      cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t    worker;
+#if defined(__linux__)
+    cpu_set_t allowed;
+#endif  /* __linux__ */
+
+    ASSERT(NULL != p_pool);
+
+    if (cpus < 1)
+    {
+        cpus = 1;
+    }
+
+    if (0u == threads)
+    {
+        threads = (size_t)cpus;
+    }
+
+    /*
+     * The caller is one of the threads of a call.
+     */
+    p_pool->worker_count = threads - 1u;
+
+    if (p_pool->worker_count > PRESENT_POOL_THREADS_MAX)
+    {
+        p_pool->worker_count = PRESENT_POOL_THREADS_MAX;
+    }
+
+    p_pool->threshold  = threshold;
+    p_pool->generation = 0u;
+    p_pool->tickets    = 0u;
+    p_pool->running    = 0u;
+    p_pool->stop       = false;
+
+    present_numa_init(&p_pool->numa);
+
+#if defined(__linux__)
+    /*
+     * Bind the workers to the CPUs that the process may run on, which
+     * skips the offline and the isolated CPUs.
+     */
+    if (affinity && (0 != sched_getaffinity(0, sizeof(allowed), &allowed)))
+    {
+        return false;
+    }
+#else
+    (void)affinity;
+#endif  /* __linux__ */
+
+    if (0 != pthread_mutex_init(&p_pool->call_lock, NULL))
+    {
+        return false;
+    }
+
+    if (0 != pthread_mutex_init(&p_pool->lock, NULL))
+    {
+        pthread_mutex_destroy(&p_pool->call_lock);
+        return false;
+    }
+
+    if (0 != pthread_cond_init(&p_pool->wake, NULL))
+    {
+        pthread_mutex_destroy(&p_pool->lock);
+        pthread_mutex_destroy(&p_pool->call_lock);
+        return false;
+    }
+
+    if (0 != pthread_cond_init(&p_pool->done, NULL))
+    {
+        pthread_cond_destroy(&p_pool->wake);
+        pthread_mutex_destroy(&p_pool->lock);
+        pthread_mutex_destroy(&p_pool->call_lock);
+        return false;
+    }
+
+    for (worker = 0u; worker < p_pool->worker_count; worker++)
+    {
+        if (0 != pthread_create(&p_pool->workers[worker], NULL, \
+                                present_pool_worker, p_pool))
+        {
+            present_pool_stop(p_pool, worker);
+            return false;
+        }
+
+#if defined(__linux__)
+        /*
+         * Leave the first CPU to the caller, which is not bound.
+         */
+        if (affinity && !present_pool_bind(p_pool->workers[worker], \
+                                           &allowed, worker + 1u))
+        {
+            present_pool_stop(p_pool, worker + 1u);
+            return false;
+        }
+#endif  /* __linux__ */
+    }
+
+    return true;
+}  /* present_pool_init() */
+
+void
+present_pool_destroy (present_pool_t * p_pool)
+{
+    ASSERT(NULL != p_pool);
+
+    present_pool_stop(p_pool, p_pool->worker_count);
+}  /* present_pool_destroy() */
+
+void
+present_pool_encrypt_blocks (present_pool_t * p_pool, \
+                             present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_pool);
+    ASSERT(NULL != p_ctx);
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    if (count * PRESENT_CRYPT_SIZE < p_pool->threshold)
+    {
+        present_encrypt_blocks(p_ctx, p_dst, p_src, count);
+        return;
+    }
+
+    pthread_mutex_lock(&p_pool->call_lock);
+
+    p_pool->op    = PRESENT_POOL_ENCRYPT;
+    p_pool->p_ctx = p_ctx;
+    p_pool->p_dst = p_dst;
+    p_pool->p_src = p_src;
+    p_pool->count = count;
+
+    present_pool_call(p_pool);
+
+    pthread_mutex_unlock(&p_pool->call_lock);
+}  /* present_pool_encrypt_blocks() */
+
+void
+present_pool_decrypt_blocks (present_pool_t * p_pool, \
+                             present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_pool);
+    ASSERT(NULL != p_ctx);
+    ASSERT((NULL != p_dst) || (0u == count));
+    ASSERT((NULL != p_src) || (0u == count));
+
+    if (count * PRESENT_CRYPT_SIZE < p_pool->threshold)
+    {
+        present_decrypt_blocks(p_ctx, p_dst, p_src, count);
+        return;
+    }
+
+    pthread_mutex_lock(&p_pool->call_lock);
+
+    p_pool->op    = PRESENT_POOL_DECRYPT;
+    p_pool->p_ctx = p_ctx;
+    p_pool->p_dst = p_dst;
+    p_pool->p_src = p_src;
+    p_pool->count = count;
+
+    present_pool_call(p_pool);
+
+    pthread_mutex_unlock(&p_pool->call_lock);
+}  /* present_pool_decrypt_blocks() */
+
+bool
+present_pool_ctr_crypt (present_pool_t * p_pool, present_ctr_t * p_ctr, \
+                        uint8_t * p_dst, uint8_t const * p_src, size_t size)
+{
+    size_t part;
+    size_t count;
+
+    ASSERT(NULL != p_pool);
+    ASSERT(NULL != p_ctr);
+    ASSERT((NULL != p_dst) || (0u == size));
+    ASSERT((NULL != p_src) || (0u == size));
+
+    if (size < p_pool->threshold)
+    {
+        return present_ctr_crypt(p_ctr, p_dst, p_src, size);
+    }
+
+    /*
+     * Check the whole buffer first, since the parts below are processed
+     * one after the other.
+     */
+    if (!present_ctr_check(p_ctr, size))
+    {
+        return false;
+    }
+
+    /*
+     * Use the rest of the keystream of the previous call on the caller, so
+     * that the chunks start at block boundaries.
+     */
+    part = (PRESENT_CRYPT_SIZE - p_ctr->used) % PRESENT_CRYPT_SIZE;
+    part = (part < size) ? part : size;
+
+    (void)present_ctr_crypt(p_ctr, p_dst, p_src, part);
+
+    p_dst += part;
+    p_src += part;
+    size  -= part;
+    count  = size / PRESENT_CRYPT_SIZE;
+
+    if (count > 0u)
+    {
+        pthread_mutex_lock(&p_pool->call_lock);
+
+        p_pool->op    = PRESENT_POOL_CTR;
+        p_pool->p_ctr = p_ctr;
+        p_pool->p_dst = p_dst;
+        p_pool->p_src = p_src;
+        p_pool->count = count;
+
+        present_pool_call(p_pool);
+
+        pthread_mutex_unlock(&p_pool->call_lock);
+
+        p_ctr->counter    = (p_ctr->counter + count) & p_ctr->counter_mask;
+        p_ctr->remaining -= count;
+    }
+
+    /*
+     * The partial block at the end keeps its keystream for the next call.
+     */
+    part = count * PRESENT_CRYPT_SIZE;
+
+    return present_ctr_crypt(p_ctr, &p_dst[part], &p_src[part], \
+                             size - part);
+}  /* present_pool_ctr_crypt() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static void
+present_pool_call (present_pool_t * p_pool)
+{
+    size_t total;
+    size_t helpers;
+
+    total = (p_pool->count + PRESENT_POOL_CHUNK_BLOCKS - 1u) \
+            / PRESENT_POOL_CHUNK_BLOCKS;
+
+    /*
+     * A round sorts a bounded count of chunks, so that the state of the
+     * pool does not grow with the call.
+     */
+    for (p_pool->base = 0u; p_pool->base < total;
+         p_pool->base += PRESENT_POOL_ROUND)
+    {
+        p_pool->chunks = total - p_pool->base;
+        p_pool->chunks = (p_pool->chunks < PRESENT_POOL_ROUND) \
+                         ? p_pool->chunks : PRESENT_POOL_ROUND;
+
+        present_pool_sort(p_pool);
+
+        /*
+         * The caller takes a chunk as well, so wake a worker per other
+         * chunk.
+         */
+        helpers = p_pool->chunks - 1u;
+        helpers = (helpers < p_pool->worker_count) ? helpers \
+                                                   : p_pool->worker_count;
+
+        pthread_mutex_lock(&p_pool->lock);
+
+        p_pool->generation++;
+        p_pool->tickets = helpers;
+        p_pool->running = helpers;
+
+        if (helpers > 0u)
+        {
+            pthread_cond_broadcast(&p_pool->wake);
+        }
+
+        pthread_mutex_unlock(&p_pool->lock);
+
+        present_pool_run(p_pool);
+
+        /*
+         * Wait for the workers that joined the round, since the next round
+         * overwrites the fields that they read.
+         */
+        pthread_mutex_lock(&p_pool->lock);
+
+        while (p_pool->running > 0u)
+        {
+            pthread_cond_wait(&p_pool->done, &p_pool->lock);
+        }
+
+        pthread_mutex_unlock(&p_pool->lock);
+    }
+}  /* present_pool_call() */
+
+static void
+present_pool_sort (present_pool_t * p_pool)
+{
+    size_t const nodes = p_pool->numa.node_count;
+    size_t       chunk;
+    size_t       node;
+
+    for (chunk = 0u; chunk < p_pool->chunks; chunk++)
+    {
+        p_pool->chunk_nodes[chunk] = 0u;
+        p_pool->p_addrs[chunk]     = &p_pool->p_src[(p_pool->base + chunk) \
+                                                    * PRESENT_POOL_CHUNK];
+    }
+
+    if (nodes > 1u)
+    {
+        present_numa_query(&p_pool->numa, p_pool->p_addrs, \
+                           p_pool->chunk_nodes, p_pool->chunks);
+    }
+
+    for (node = 0u; node <= nodes; node++)
+    {
+        p_pool->node_first[node] = 0u;
+    }
+
+    /*
+     * Spread the chunks of the unknown nodes, and count the chunks of
+     * every node after its own entry.
+     */
+    for (chunk = 0u; chunk < p_pool->chunks; chunk++)
+    {
+        if (p_pool->chunk_nodes[chunk] >= nodes)
+        {
+            p_pool->chunk_nodes[chunk] = chunk % nodes;
+        }
+
+        p_pool->node_first[p_pool->chunk_nodes[chunk] + 1u]++;
+    }
+
+    for (node = 0u; node < nodes; node++)
+    {
+        p_pool->node_first[node + 1u] += p_pool->node_first[node];
+        p_pool->node_next[node]        = 0u;
+    }
+
+    /*
+     * Use the taken counts to place the chunks, then reset them.
+     */
+    for (chunk = 0u; chunk < p_pool->chunks; chunk++)
+    {
+        node = p_pool->chunk_nodes[chunk];
+
+        p_pool->order[p_pool->node_first[node] + p_pool->node_next[node]++] \
+            = chunk;
+    }
+
+    for (node = 0u; node < nodes; node++)
+    {
+        p_pool->node_next[node] = 0u;
+    }
+}  /* present_pool_sort() */
+
+static void
+present_pool_run (present_pool_t * p_pool)
+{
+    size_t const nodes = p_pool->numa.node_count;
+    size_t       own   = (nodes > 1u) ? present_numa_current(&p_pool->numa) \
+                                      : 0u;
+    size_t       visit;
+    size_t       node;
+    size_t       count;
+    size_t       index;
+
+    for (visit = 0u; visit < nodes; visit++)
+    {
+        node  = (own + visit) % nodes;
+        count = p_pool->node_first[node + 1u] - p_pool->node_first[node];
+
+        while ((index = __atomic_fetch_add(&p_pool->node_next[node], 1u, \
+                                           __ATOMIC_RELAXED)) < count)
+        {
+            present_pool_chunk(p_pool, p_pool->base \
+                               + p_pool->order[p_pool->node_first[node] \
+                                               + index]);
+        }
+    }
+}  /* present_pool_run() */
+
+static void
+present_pool_chunk (present_pool_t * p_pool, size_t chunk)
+{
+    present_ctr_t   ctr;
+    uint8_t *       p_dst;
+    uint8_t const * p_src;
+    size_t          first  = chunk * PRESENT_POOL_CHUNK_BLOCKS;
+    size_t          count  = p_pool->count - first;
+    size_t          offset = first * PRESENT_CRYPT_SIZE;
+
+    count = (count < PRESENT_POOL_CHUNK_BLOCKS) ? count \
+                                                : PRESENT_POOL_CHUNK_BLOCKS;
+    p_dst = &p_pool->p_dst[offset];
+    p_src = &p_pool->p_src[offset];
+
+    if (PRESENT_POOL_ENCRYPT == p_pool->op)
+    {
+        present_encrypt_blocks(p_pool->p_ctx, p_dst, p_src, count);
+    }
+    else if (PRESENT_POOL_DECRYPT == p_pool->op)
+    {
+        present_decrypt_blocks(p_pool->p_ctx, p_dst, p_src, count);
+    }
+    else
+    {
+        /*
+         * Start the counter of the chunk at its first block.
+         */
+        ctr            = *p_pool->p_ctr;
+        ctr.counter    = (ctr.counter + first) & ctr.counter_mask;
+        ctr.remaining -= first;
+
+        (void)present_ctr_crypt(&ctr, p_dst, p_src, \
+                                count * PRESENT_CRYPT_SIZE);
+    }
+}  /* present_pool_chunk() */
+
+static void *
+present_pool_worker (void * p_arg)
+{
+    present_pool_t * p_pool     = (present_pool_t *)p_arg;
+    unsigned long    generation = 0u;
+
+    pthread_mutex_lock(&p_pool->lock);
+
+    for (;;)
+    {
+        while (!p_pool->stop && (generation == p_pool->generation))
+        {
+            pthread_cond_wait(&p_pool->wake, &p_pool->lock);
+        }
+
+        if (p_pool->stop)
+        {
+            break;
+        }
+
+        generation = p_pool->generation;
+
+        /*
+         * A worker without a ticket is not waited by the caller, so it
+         * must not touch the call.
+         */
+        if (0u == p_pool->tickets)
+        {
+            continue;
+        }
+
+        p_pool->tickets--;
+
+        pthread_mutex_unlock(&p_pool->lock);
+        present_pool_run(p_pool);
+        pthread_mutex_lock(&p_pool->lock);
+
+        if (0u == --p_pool->running)
+        {
+            pthread_cond_signal(&p_pool->done);
+        }
+    }
+
+    pthread_mutex_unlock(&p_pool->lock);
+
+    return NULL;
+}  /* present_pool_worker() */
+
+static void
+present_pool_stop (present_pool_t * p_pool, size_t count)
+{
+    size_t worker;
+
+    pthread_mutex_lock(&p_pool->lock);
+
+    p_pool->stop = true;
+    pthread_cond_broadcast(&p_pool->wake);
+
+    pthread_mutex_unlock(&p_pool->lock);
+
+    for (worker = 0u; worker < count; worker++)
+    {
+        pthread_join(p_pool->workers[worker], NULL);
+    }
+
+    pthread_cond_destroy(&p_pool->done);
+    pthread_cond_destroy(&p_pool->wake);
+    pthread_mutex_destroy(&p_pool->lock);
+    pthread_mutex_destroy(&p_pool->call_lock);
+}  /* present_pool_stop() */
+
+#if defined(__linux__)
+static bool
+present_pool_bind (pthread_t thread, cpu_set_t const * p_cpus, size_t index)
+{
+    cpu_set_t set;
+    int       count = CPU_COUNT(p_cpus);
+    int       cpu;
+
+    if (count < 1)
+    {
+        return false;
+    }
+
+    /*
+     * Find the CPU at the index among the set ones.
+     */
+    index %= (size_t)count;
+
+    for (cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+        if (CPU_ISSET(cpu, p_cpus))
+        {
+            if (0u == index)
+            {
+                break;
+            }
+
+            index--;
+        }
+    }
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    return 0 == pthread_setaffinity_np(thread, sizeof(set), &set);
+}  /* present_pool_bind() */
+#endif  /* __linux__ */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_pool_unused_t;
+
+#endif  /* CONF_PRESENT_POOL */
+
+/*** END OF FILE ***/
@@ -0,0 +1,688 @@
+/**
+ * @file present_sched.c
+ * @brief Source file of the PRESENT work-stealing scheduler.
+ *
+ * The file is the C implementation of the PRESENT work-stealing scheduler.
+ * The file contains global and static function definitions, data
+ * structures, type definitions, etc, of the module.
+ *
+ * The deques are rings guarded by a spin lock each, since a deque is only
+ * touched for a pop or a steal of a single job, or a push of a few jobs. A
+ * batch is split into a slice per worker, so that the workers start on
+ * different deques, and a slice is pushed in small batches, so that the
+ * owner and the thieves do not wait for the whole slice. The idle workers
+ * sleep on a condition until the next submission.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+
+/*
+ * The monotonic clock is a POSIX extension.
+ */
+#if !defined(_POSIX_C_SOURCE)
+#   define _POSIX_C_SOURCE 200809L
+#endif  /* _POSIX_C_SOURCE */
+
+#include <present_sched.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_SCHED)
+
+#if CONF_PRESENT_SCHED
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <time.h>
+#include <unistd.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present_cbc.h>
+#include <present_ctr.h>
+#include <assert.h>
+#include <cpu.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if !CONF_PRESENT_CBC || !CONF_PRESENT_CTR
+#   error "Work-stealing scheduler requires the CBC and the counter modes!"
+#endif
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Gets the monotonic time.
+ *
+ * @return The time in nanosecond.
+ */
+static uint64_t
+present_sched_now(void);
+
+/**
+ * @brief Takes the deque lock of a worker.
+ *
+ * The function pauses while the lock is held, and yields the CPU after a
+ * while, in case that the holder was preempted.
+ *
+ * @param[in,out] p_worker Pointer of the worker.
+ *
+ * @return None.
+ */
+static void
+present_sched_lock(present_sched_worker_t * p_worker);
+
+/**
+ * @brief Pushes jobs into the deque of a worker.
+ *
+ * The function takes the lock for at most @ref PRESENT_SCHED_BATCH jobs at
+ * a time.
+ *
+ * @param[in,out] p_worker Pointer of the worker.
+ * @param[in]     pp_jobs  Array of the job pointers.
+ * @param[in]     count    Count of the jobs.
+ *
+ * @return Count of the pushed jobs, which is less than the count only if
+ *         the deque is full.
+ */
+static size_t
+present_sched_push(present_sched_worker_t * p_worker, \
+                   present_sched_job_t * const * pp_jobs, size_t count);
+
+/**
+ * @brief Takes the newest job of the own deque of a worker.
+ *
+ * @param[in,out] p_worker Pointer of the worker.
+ *
+ * @return Pointer of the job, or NULL if the deque is empty.
+ */
+static present_sched_job_t *
+present_sched_pop(present_sched_worker_t * p_worker);
+
+/**
+ * @brief Takes the oldest job of the deque of another worker.
+ *
+ * The function visits the other workers from a random one.
+ *
+ * @param[in,out] p_sched  Pointer of the scheduler.
+ * @param[in,out] p_worker Pointer of the stealing worker.
+ *
+ * @return Pointer of the job, or NULL if all deques are empty.
+ */
+static present_sched_job_t *
+present_sched_steal(present_sched_t * p_sched, \
+                    present_sched_worker_t * p_worker);
+
+/**
+ * @brief Processes a job.
+ *
+ * @param[in,out] p_sched  Pointer of the scheduler.
+ * @param[in,out] p_worker Pointer of the worker.
+ * @param[in,out] p_job    Pointer of the job.
+ *
+ * @return None.
+ */
+static void
+present_sched_run(present_sched_t * p_sched, \
+                  present_sched_worker_t * p_worker, \
+                  present_sched_job_t * p_job);
+
+/**
+ * @brief Main function of the worker threads.
+ *
+ * @param[in,out] p_arg Pointer of the worker.
+ *
+ * @return NULL.
+ */
+static void *
+present_sched_worker(void * p_arg);
+
+/**
+ * @brief Stops the first workers of the scheduler.
+ *
+ * @param[in,out] p_sched Pointer of the scheduler.
+ * @param[in]     count   Count of the started workers.
+ *
+ * @return None.
+ */
+static void
+present_sched_stop(present_sched_t * p_sched, size_t count);
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+bool
+present_sched_init (present_sched_t * p_sched, size_t threads)
+{
+    present_sched_worker_t * p_worker;
+    long                     cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t                   worker;
+
+    ASSERT(NULL != p_sched);
+
+    if (0u == threads)
+    {
+        threads = (cpus > 0) ? (size_t)cpus : 1u;
+    }
+
+    p_sched->worker_count = threads;
+
+    if (p_sched->worker_count > PRESENT_SCHED_THREADS_MAX)
+    {
+        p_sched->worker_count = PRESENT_SCHED_THREADS_MAX;
+    }
+
+    p_sched->next      = 0u;
+    p_sched->queued    = 0u;
+    p_sched->submitted = 0u;
+    p_sched->completed = 0u;
+    p_sched->stop      = false;
+    p_sched->start_ns  = present_sched_now();
+
+    if (0 != pthread_mutex_init(&p_sched->lock, NULL))
+    {
+        return false;
+    }
+
+    if (0 != pthread_cond_init(&p_sched->wake, NULL))
+    {
+        pthread_mutex_destroy(&p_sched->lock);
+        return false;
+    }
+
+    if (0 != pthread_cond_init(&p_sched->idle, NULL))
+    {
+        pthread_cond_destroy(&p_sched->wake);
+        pthread_mutex_destroy(&p_sched->lock);
+        return false;
+    }
+
+    for (worker = 0u; worker < p_sched->worker_count; worker++)
+    {
+        p_worker = &p_sched->workers[worker];
+
+        p_worker->p_sched  = p_sched;
+        p_worker->top      = 0u;
+        p_worker->bottom   = 0u;
+        p_worker->lock     = 0u;
+        p_worker->seed     = (uint32_t)(worker * 2654435761u) | 1u;
+        p_worker->executed = 0u;
+        p_worker->stolen   = 0u;
+        p_worker->busy_ns  = 0u;
+    }
+
+    for (worker = 0u; worker < p_sched->worker_count; worker++)
+    {
+        if (0 != pthread_create(&p_sched->workers[worker].thread, NULL, \
+                                present_sched_worker, \
+                                &p_sched->workers[worker]))
+        {
+            present_sched_stop(p_sched, worker);
+            return false;
+        }
+    }
+
+    return true;
+}  /* present_sched_init() */
+
+void
+present_sched_destroy (present_sched_t * p_sched)
+{
+    ASSERT(NULL != p_sched);
+
+    present_sched_wait(p_sched);
+    present_sched_stop(p_sched, p_sched->worker_count);
+}  /* present_sched_destroy() */
+
+size_t
+present_sched_submit (present_sched_t * p_sched, \
+                      present_sched_job_t * const * pp_jobs, size_t count)
+{
+    present_sched_worker_t * p_worker;
+    uint64_t                 now   = present_sched_now();
+    size_t                   slice;
+    size_t                   part;
+    size_t                   done  = 0u;
+    size_t                   full  = 0u;
+    size_t                   job;
+
+    ASSERT(NULL != p_sched);
+    ASSERT((NULL != pp_jobs) || (0u == count));
+
+    for (job = 0u; job < count; job++)
+    {
+        pp_jobs[job]->submit_ns = now;
+        pp_jobs[job]->ok        = false;
+        pp_jobs[job]->done      = 0u;
+    }
+
+    /*
+     * Count the jobs before they are visible, so that the counters never
+     * go below the count of the running jobs.
+     */
+    __atomic_fetch_add(&p_sched->submitted, count, __ATOMIC_RELEASE);
+    __atomic_fetch_add(&p_sched->queued, count, __ATOMIC_RELEASE);
+
+    slice = (count + p_sched->worker_count - 1u) / p_sched->worker_count;
+
+    while ((done < count) && (full < p_sched->worker_count))
+    {
+        job      = __atomic_fetch_add(&p_sched->next, 1u, __ATOMIC_RELAXED);
+        p_worker = &p_sched->workers[job % p_sched->worker_count];
+
+        part = count - done;
+        part = (part < slice) ? part : slice;
+        part = present_sched_push(p_worker, &pp_jobs[done], part);
+
+        done += part;
+        full  = (0u == part) ? full + 1u : 0u;
+    }
+
+    pthread_mutex_lock(&p_sched->lock);
+
+    /*
+     * Take back the jobs that did not fit, and tell the waiting callers if
+     * the rest is already done.
+     */
+    __atomic_fetch_sub(&p_sched->submitted, count - done, __ATOMIC_RELEASE);
+    __atomic_fetch_sub(&p_sched->queued, count - done, __ATOMIC_RELEASE);
+
+    if (done > 0u)
+    {
+        pthread_cond_broadcast(&p_sched->wake);
+    }
+
+    if (__atomic_load_n(&p_sched->completed, __ATOMIC_ACQUIRE)
+        == __atomic_load_n(&p_sched->submitted, __ATOMIC_ACQUIRE))
+    {
+        pthread_cond_broadcast(&p_sched->idle);
+    }
+
+    pthread_mutex_unlock(&p_sched->lock);
+
+    return done;
+}  /* present_sched_submit() */
+
+void
+present_sched_wait (present_sched_t * p_sched)
+{
+    ASSERT(NULL != p_sched);
+
+    pthread_mutex_lock(&p_sched->lock);
+
+    while (__atomic_load_n(&p_sched->completed, __ATOMIC_ACQUIRE)
+           != __atomic_load_n(&p_sched->submitted, __ATOMIC_ACQUIRE))
+    {
+        pthread_cond_wait(&p_sched->idle, &p_sched->lock);
+    }
+
+    pthread_mutex_unlock(&p_sched->lock);
+}  /* present_sched_wait() */
+
+void
+present_sched_stats (present_sched_t * p_sched, \
+                     present_sched_stats_t * p_stats)
+{
+    present_sched_worker_t * p_worker;
+    size_t                   worker;
+
+    ASSERT(NULL != p_sched);
+    ASSERT(NULL != p_stats);
+
+    p_stats->submitted = __atomic_load_n(&p_sched->submitted, \
+                                         __ATOMIC_RELAXED);
+    p_stats->completed = __atomic_load_n(&p_sched->completed, \
+                                         __ATOMIC_RELAXED);
+    p_stats->stolen    = 0u;
+    p_stats->busy_ns   = 0u;
+
+    for (worker = 0u; worker < p_sched->worker_count; worker++)
+    {
+        p_worker = &p_sched->workers[worker];
+
+        p_stats->stolen  += __atomic_load_n(&p_worker->stolen, \
+                                            __ATOMIC_RELAXED);
+        p_stats->busy_ns += __atomic_load_n(&p_worker->busy_ns, \
+                                            __ATOMIC_RELAXED);
+    }
+
+    p_stats->capacity_ns = (present_sched_now() - p_sched->start_ns) \
+                           * p_sched->worker_count;
+}  /* present_sched_stats() */
+
+bool
+present_sched_crypt (present_sched_op_t op, present_ctx_t const * p_ctx, \
+                     uint8_t * p_iv, uint8_t counter_bits, uint8_t * p_dst, \
+                     uint8_t const * p_src, size_t size)
+{
+    present_ctr_t ctr;
+    size_t        count = size / PRESENT_CRYPT_SIZE;
+    bool          ok    = (0u == size % PRESENT_CRYPT_SIZE);
+
+    ASSERT(NULL != p_ctx);
+    ASSERT(NULL != p_iv);
+    ASSERT(((NULL != p_dst) && (NULL != p_src)) || (0u == size));
+
+    switch (op)
+    {
+        case PRESENT_SCHED_ECB_ENCRYPT:
+            if (ok)
+            {
+                present_encrypt_blocks(p_ctx, p_dst, p_src, count);
+            }
+            break;
+
+        case PRESENT_SCHED_ECB_DECRYPT:
+            if (ok)
+            {
+                present_decrypt_blocks(p_ctx, p_dst, p_src, count);
+            }
+            break;
+
+        case PRESENT_SCHED_CBC_ENCRYPT:
+            if (ok)
+            {
+                present_cbc_encrypt(p_ctx, p_iv, p_dst, p_src, count);
+            }
+            break;
+
+        case PRESENT_SCHED_CBC_DECRYPT:
+            if (ok)
+            {
+                present_cbc_decrypt(p_ctx, p_iv, p_dst, p_src, count);
+            }
+            break;
+
+        case PRESENT_SCHED_CTR:
+            ok = present_ctr_init(&ctr, p_ctx, p_iv, counter_bits);
+
+            ok = ok && present_ctr_crypt(&ctr, p_dst, p_src, size);
+            break;
+
+        default:
+            ok = false;
+            break;
+    }
+
+    return ok;
+}  /* present_sched_crypt() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static uint64_t
+present_sched_now (void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * UINT64_C(1000000000) \
+           + (uint64_t)now.tv_nsec;
+}  /* present_sched_now() */
+
+static void
+present_sched_lock (present_sched_worker_t * p_worker)
+{
+    unsigned int spins = 0u;
+
+    while (__atomic_test_and_set(&p_worker->lock, __ATOMIC_ACQUIRE))
+    {
+        while (__atomic_load_n(&p_worker->lock, __ATOMIC_RELAXED))
+        {
+            cpu_spin(&spins);
+        }
+    }
+}  /* present_sched_lock() */
+
+static size_t
+present_sched_push (present_sched_worker_t * p_worker, \
+                    present_sched_job_t * const * pp_jobs, size_t count)
+{
+    size_t pushed = 0u;
+    size_t room   = 1u;
+    size_t part;
+    size_t job;
+
+    while ((pushed < count) && (0u != room))
+    {
+        present_sched_lock(p_worker);
+
+        room = PRESENT_SCHED_DEQUE - (p_worker->bottom - p_worker->top);
+        part = count - pushed;
+        part = (part < PRESENT_SCHED_BATCH) ? part : PRESENT_SCHED_BATCH;
+        part = (part < room) ? part : room;
+
+        for (job = 0u; job < part; job++)
+        {
+            p_worker->p_jobs[p_worker->bottom % PRESENT_SCHED_DEQUE] = \
+                pp_jobs[pushed + job];
+            __atomic_store_n(&p_worker->bottom, p_worker->bottom + 1u, \
+                             __ATOMIC_RELEASE);
+        }
+
+        __atomic_clear(&p_worker->lock, __ATOMIC_RELEASE);
+
+        pushed += part;
+    }
+
+    return pushed;
+}  /* present_sched_push() */
+
+static present_sched_job_t *
+present_sched_pop (present_sched_worker_t * p_worker)
+{
+    present_sched_job_t * p_job = NULL;
+
+    /*
+     * Skip the lock if the deque looks empty. A job pushed right after the
+     * check is taken at the next pass.
+     */
+    if (__atomic_load_n(&p_worker->bottom, __ATOMIC_ACQUIRE)
+        == __atomic_load_n(&p_worker->top, __ATOMIC_ACQUIRE))
+    {
+        return NULL;
+    }
+
+    present_sched_lock(p_worker);
+
+    if (p_worker->bottom != p_worker->top)
+    {
+        __atomic_store_n(&p_worker->bottom, p_worker->bottom - 1u, \
+                         __ATOMIC_RELEASE);
+        p_job = p_worker->p_jobs[p_worker->bottom % PRESENT_SCHED_DEQUE];
+    }
+
+    __atomic_clear(&p_worker->lock, __ATOMIC_RELEASE);
+
+    return p_job;
+}  /* present_sched_pop() */
+
+static present_sched_job_t *
+present_sched_steal (present_sched_t * p_sched, \
+                     present_sched_worker_t * p_worker)
+{
+    present_sched_worker_t * p_victim;
+    present_sched_job_t *    p_job = NULL;
+    uint32_t                 seed  = p_worker->seed;
+    size_t                   first;
+    size_t                   visit;
+
+    /*
+     * Start from a random victim, so that the thieves spread over the
+     * deques instead of all hitting the first one.
+     */
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+
+    p_worker->seed = seed;
+    first          = seed % p_sched->worker_count;
+
+    for (visit = 0u; (visit < p_sched->worker_count) && (NULL == p_job);
+         visit++)
+    {
+        p_victim = &p_sched->workers[(first + visit) % p_sched->worker_count];
+
+        if ((p_victim == p_worker)
+            || (__atomic_load_n(&p_victim->bottom, __ATOMIC_ACQUIRE)
+                == __atomic_load_n(&p_victim->top, __ATOMIC_ACQUIRE)))
+        {
+            continue;
+        }
+
+        present_sched_lock(p_victim);
+
+        if (p_victim->bottom != p_victim->top)
+        {
+            p_job = p_victim->p_jobs[p_victim->top % PRESENT_SCHED_DEQUE];
+            __atomic_store_n(&p_victim->top, p_victim->top + 1u, \
+                             __ATOMIC_RELEASE);
+        }
+
+        __atomic_clear(&p_victim->lock, __ATOMIC_RELEASE);
+    }
+
+    if (NULL != p_job)
+    {
+        __atomic_fetch_add(&p_worker->stolen, 1ul, __ATOMIC_RELAXED);
+    }
+
+    return p_job;
+}  /* present_sched_steal() */
+
+static void
+present_sched_run (present_sched_t * p_sched, \
+                   present_sched_worker_t * p_worker, \
+                   present_sched_job_t * p_job)
+{
+    uint64_t start = present_sched_now();
+
+    p_job->start_ns = start;
+
+    p_job->ok = present_sched_crypt(p_job->op, p_job->p_ctx, p_job->iv, \
+                                    p_job->counter_bits, p_job->p_dst, \
+                                    p_job->p_src, p_job->size);
+
+    p_job->done_ns = present_sched_now();
+
+    __atomic_fetch_add(&p_worker->executed, 1ul, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&p_worker->busy_ns, p_job->done_ns - start, \
+                       __ATOMIC_RELAXED);
+    __atomic_store_n(&p_job->done, 1u, __ATOMIC_RELEASE);
+
+    /*
+     * Only the last job of the submitted ones takes the lock.
+     */
+    if (__atomic_add_fetch(&p_sched->completed, 1ul, __ATOMIC_ACQ_REL)
+        == __atomic_load_n(&p_sched->submitted, __ATOMIC_ACQUIRE))
+    {
+        pthread_mutex_lock(&p_sched->lock);
+        pthread_cond_broadcast(&p_sched->idle);
+        pthread_mutex_unlock(&p_sched->lock);
+    }
+}  /* present_sched_run() */
+
+static void *
+present_sched_worker (void * p_arg)
+{
+    present_sched_worker_t * p_worker = (present_sched_worker_t *)p_arg;
+    present_sched_t *        p_sched  = (present_sched_t *)p_worker->p_sched;
+    present_sched_job_t *    p_job;
+
+    for (;;)
+    {
+        p_job = present_sched_pop(p_worker);
+
+        if (NULL == p_job)
+        {
+            p_job = present_sched_steal(p_sched, p_worker);
+        }
+
+        if (NULL != p_job)
+        {
+            __atomic_fetch_sub(&p_sched->queued, 1u, __ATOMIC_RELEASE);
+            present_sched_run(p_sched, p_worker, p_job);
+            continue;
+        }
+
+        pthread_mutex_lock(&p_sched->lock);
+
+        while (!p_sched->stop
+               && (0u == __atomic_load_n(&p_sched->queued, __ATOMIC_ACQUIRE)))
+        {
+            pthread_cond_wait(&p_sched->wake, &p_sched->lock);
+        }
+
+        if (p_sched->stop)
+        {
+            pthread_mutex_unlock(&p_sched->lock);
+            break;
+        }
+
+        pthread_mutex_unlock(&p_sched->lock);
+    }
+
+    return NULL;
+}  /* present_sched_worker() */
+
+static void
+present_sched_stop (present_sched_t * p_sched, size_t count)
+{
+    size_t worker;
+
+    pthread_mutex_lock(&p_sched->lock);
+
+    p_sched->stop = true;
+    pthread_cond_broadcast(&p_sched->wake);
+
+    pthread_mutex_unlock(&p_sched->lock);
+
+    for (worker = 0u; worker < count; worker++)
+    {
+        pthread_join(p_sched->workers[worker].thread, NULL);
+    }
+
+    pthread_cond_destroy(&p_sched->idle);
+    pthread_cond_destroy(&p_sched->wake);
+    pthread_mutex_destroy(&p_sched->lock);
+}  /* present_sched_stop() */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_sched_unused_t;
+
+#endif  /* CONF_PRESENT_SCHED */
+
+/*** END OF FILE ***/
@@ -0,0 +1,1832 @@
+/**
+ * @file present_simd.c
+ * @brief Source file of the PRESENT SSSE3 and AVX2 engines.
+ *
+ * The file is the C implementation of the PRESENT crypt engines that use
+ * the x86 vector extensions. The file contains global and static function
+ * definitions, data structures, type definitions, etc, of the engines.
+ *
+ * Every 64-bit lane of a vector register holds a text block, so a 128-bit
+ * register holds two and a 256-bit register holds four blocks. The lookup
+ * tables @ref g_sbox and @ref g_sbox_inv have 16 entries, which is exactly
+ * the size of a PSHUFB lookup. Therefore, all the nibbles of a register are
+ * substituted with two shuffles. The permutation layer is composed of the
+ * delta swaps of the 64-bit word engine.
+ *
+ * The functions are compiled for their instruction set with the target
+ * attribute, so the rest of the project does not require the extensions.
+ * The module selects these engines only if the host CPU supports them.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @see <a href=
+ *      "https://link.springer.com/chapter/10.1007%2F978-3-540-74735-2_31">
+ *      PRESENT: An Ultra-Lightweight Block Cipher</a>
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_engine.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_SIMD)
+
+#if CPU_USE_X86
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <immintrin.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <assert.h>
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Function attributes of the SSSE3 engine.
+ */
+#define PRESENT_SSSE3 __attribute__((target("ssse3")))
+
+/*
+ * Function attributes of the AVX2 engine.
+ */
+#define PRESENT_AVX2  __attribute__((target("avx2")))
+
+/*
+ * Count of the registers that are processed together to hide the latency
+ * of the instructions.
+ */
+#define PRESENT_SIMD_WAYS (4u)
+
+/*
+ * Count of the text blocks in a 128-bit register.
+ */
+#define PRESENT_SSSE3_LANES (2u)
+
+/*
+ * Count of the text blocks in a 256-bit register.
+ */
+#define PRESENT_AVX2_LANES  (4u)
+
+/*
+ * Mask of the 16-bit high part of the 80-bit key register.
+ */
+#define PRESENT_KEY80_HIGH_MASK (0xFFFFu)
+
+/*****************************************************************************/
+/* STATIC MACRO FUNCTIONS                                                    */
+/*****************************************************************************/
+
+/*
+ * Delta swap of the 64-bit lanes of a 128-bit register.
+ */
+#define PRESENT_SSSE3_SWAP(x, mask, delta)                                   \
+    do {                                                                     \
+        __m128i t_ = _mm_and_si128(_mm_xor_si128(_mm_srli_epi64(x, delta),   \
+                                                 x), mask);                  \
+        (x) = _mm_xor_si128(_mm_xor_si128(x, t_), _mm_slli_epi64(t_, delta));\
+    } while (0)
+
+/*
+ * Delta swap of the 64-bit lanes of a 256-bit register.
+ */
+#define PRESENT_AVX2_SWAP(x, mask, delta)                                    \
+    do {                                                                     \
+        __m256i t_ = _mm256_and_si256(                                       \
+            _mm256_xor_si256(_mm256_srli_epi64(x, delta), x), mask);         \
+        (x) = _mm256_xor_si256(_mm256_xor_si256(x, t_),                      \
+                               _mm256_slli_epi64(t_, delta));                \
+    } while (0)
+
+/*****************************************************************************/
+/* DATA TYPE DEFINITIONS                                                     */
+/*****************************************************************************/
+
+/**
+ * This type holds the constants of the SSSE3 engine in registers.
+ */
+typedef struct {
+    /*! Lookup table of the low nibbles. */
+    __m128i low;
+    /*! Lookup table of the high nibbles. */
+    __m128i high;
+    /*! Mask of the low nibbles. */
+    __m128i nibble;
+    /*! Masks of the permutation delta swaps. */
+    __m128i perm[4];
+} present_ssse3_const_t;
+
+/**
+ * This type holds the constants of the AVX2 engine in registers.
+ */
+typedef struct {
+    /*! Lookup table of the low nibbles. */
+    __m256i low;
+    /*! Lookup table of the high nibbles. */
+    __m256i high;
+    /*! Mask of the low nibbles. */
+    __m256i nibble;
+    /*! Masks of the permutation delta swaps. */
+    __m256i perm[4];
+} present_avx2_const_t;
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Loads the constants of the SSSE3 engine.
+ *
+ * @param[out] p_const Pointer of the constants.
+ * @param[in]  p_sbox  Pointer of the substitution lookup table.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static void
+present_ssse3_init(present_ssse3_const_t * p_const, uint8_t const * p_sbox);
+
+/**
+ * @brief Runs the substitution and the permutation layers on a register.
+ *
+ * @param[in] x       Register of the text blocks.
+ * @param[in] p_const Pointer of the engine constants.
+ *
+ * @return Register of the text blocks after the layers.
+ */
+PRESENT_SSSE3 static PRESENT_INLINE __m128i
+present_ssse3_layers(__m128i x, present_ssse3_const_t const * p_const);
+
+/**
+ * @brief Runs the inverse permutation and substitution layers on a register.
+ *
+ * @param[in] x       Register of the text blocks.
+ * @param[in] p_const Pointer of the engine constants.
+ *
+ * @return Register of the text blocks after the layers.
+ */
+PRESENT_SSSE3 static PRESENT_INLINE __m128i
+present_ssse3_layers_inv(__m128i x, present_ssse3_const_t const * p_const);
+
+/**
+ * @brief Runs the encryption on the registers.
+ *
+ * The function encrypts the text blocks in the first \p ways registers of
+ * \p p_state.
+ *
+ * @param[in]     p_ctx   Pointer of the crypt context.
+ * @param[in]     p_const Pointer of the engine constants.
+ * @param[in,out] p_state Pointer of the registers.
+ * @param[in]     ways    Count of the registers.
+ * @param[in]     rounds  Count of the rounds.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_encrypt(present_ctx_t const * p_ctx, \
+                      present_ssse3_const_t const * p_const, \
+                      __m128i * p_state, uint8_t ways, uint8_t rounds);
+
+/**
+ * @brief Runs the decryption on the registers.
+ *
+ * The function decrypts the text blocks in the first \p ways registers of
+ * \p p_state.
+ *
+ * @param[in]     p_ctx   Pointer of the crypt context.
+ * @param[in]     p_const Pointer of the engine constants.
+ * @param[in,out] p_state Pointer of the registers.
+ * @param[in]     ways    Count of the registers.
+ * @param[in]     rounds  Count of the rounds.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_decrypt(present_ctx_t const * p_ctx, \
+                      present_ssse3_const_t const * p_const, \
+                      __m128i * p_state, uint8_t ways, uint8_t rounds);
+
+/**
+ * @brief Encrypts consecutive text blocks with the SSSE3 engine.
+ *
+ * The function is the multi-block encryption function of the SSSE3 engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the crypted text buffer.
+ * @param[in]  p_src Pointer of the raw text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static void
+present_ssse3_encrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with the SSSE3 engine.
+ *
+ * The function is the multi-block decryption function of the SSSE3 engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the raw text buffer.
+ * @param[in]  p_src Pointer of the crypted text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static void
+present_ssse3_decrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Runs the encryption on the registers with a key per lane.
+ *
+ * The function encrypts the text blocks in the first \p ways registers of
+ * \p p_state. Lane i of the registers is encrypted with the context
+ * pointed by \p pp_ctx[i].
+ *
+ * @param[in]     pp_ctx  Pointer of the crypt contexts of the lanes.
+ * @param[in]     p_const Pointer of the engine constants.
+ * @param[in,out] p_state Pointer of the registers.
+ * @param[in]     ways    Count of the registers.
+ * @param[in]     rounds  Count of the rounds.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_encrypt_multi(present_ctx_t const * const * pp_ctx, \
+                            present_ssse3_const_t const * p_const, \
+                            __m128i * p_state, uint8_t ways, uint8_t rounds);
+
+/**
+ * @brief Runs the decryption on the registers with a key per lane.
+ *
+ * The function decrypts the text blocks in the first \p ways registers of
+ * \p p_state. Lane i of the registers is decrypted with the context
+ * pointed by \p pp_ctx[i].
+ *
+ * @param[in]     pp_ctx  Pointer of the crypt contexts of the lanes.
+ * @param[in]     p_const Pointer of the engine constants.
+ * @param[in,out] p_state Pointer of the registers.
+ * @param[in]     ways    Count of the registers.
+ * @param[in]     rounds  Count of the rounds.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_decrypt_multi(present_ctx_t const * const * pp_ctx, \
+                            present_ssse3_const_t const * p_const, \
+                            __m128i * p_state, uint8_t ways, uint8_t rounds);
+
+/**
+ * @brief Encrypts consecutive text blocks with different keys.
+ *
+ * The function is the multi-key encryption function of the SSSE3 engine.
+ *
+ * @param[in]  pp_ctx Pointer of the crypt contexts of the blocks.
+ * @param[out] p_dst  Pointer of the crypted text buffer.
+ * @param[in]  p_src  Pointer of the raw text buffer.
+ * @param[in]  count  Count of the blocks.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static void
+present_ssse3_encrypt_multi_blocks(present_ctx_t const * const * pp_ctx, \
+                                   uint8_t * p_dst, uint8_t const * p_src, \
+                                   size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with different keys.
+ *
+ * The function is the multi-key decryption function of the SSSE3 engine.
+ *
+ * @param[in]  pp_ctx Pointer of the crypt contexts of the blocks.
+ * @param[out] p_dst  Pointer of the raw text buffer.
+ * @param[in]  p_src  Pointer of the crypted text buffer.
+ * @param[in]  count  Count of the blocks.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static void
+present_ssse3_decrypt_multi_blocks(present_ctx_t const * const * pp_ctx, \
+                                   uint8_t * p_dst, uint8_t const * p_src, \
+                                   size_t count);
+
+/**
+ * @brief Stores a round key of the lanes to their contexts.
+ *
+ * The function stores the round key of every lane of \p key to the
+ * context of the lane, together with the round key moved by the inverse
+ * permutation layer.
+ *
+ * @param[out] p_ctx   Pointer of the contexts of the lanes.
+ * @param[in]  p_const Pointer of the engine constants.
+ * @param[in]  key     Register of the round keys.
+ * @param[in]  round   Index of the round key.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_store_key(present_ctx_t * p_ctx, \
+                        present_ssse3_const_t const * p_const, __m128i key, \
+                        uint8_t round);
+
+/**
+ * @brief Runs the 80-bit key schedule of the keys in the lanes.
+ *
+ * @param[out] p_ctx   Pointer of the contexts of the lanes.
+ * @param[in]  p_keys  Pointer of the keys of the lanes.
+ * @param[in]  p_const Pointer of the engine constants.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static void
+present_ssse3_key_schedule80(present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                             present_ssse3_const_t const * p_const);
+
+/**
+ * @brief Runs the 128-bit key schedule of the keys in the lanes.
+ *
+ * @param[out] p_ctx   Pointer of the contexts of the lanes.
+ * @param[in]  p_keys  Pointer of the keys of the lanes.
+ * @param[in]  p_const Pointer of the engine constants.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static void
+present_ssse3_key_schedule128(present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                              present_ssse3_const_t const * p_const);
+
+/**
+ * @brief Expands a batch of keys with the SSSE3 engine.
+ *
+ * The function is the batch key setup function of the SSSE3 engine.
+ *
+ * @param[out] p_ctx    Pointer of the crypt contexts.
+ * @param[in]  p_keys   Pointer of the crypt keys.
+ * @param[in]  key_size Size of a key in byte.
+ * @param[in]  count    Count of the keys.
+ *
+ * @return None.
+ */
+PRESENT_SSSE3 static void
+present_ssse3_key_setup(present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                        size_t key_size, size_t count);
+
+/**
+ * @brief Loads the constants of the AVX2 engine.
+ *
+ * @param[out] p_const Pointer of the constants.
+ * @param[in]  p_sbox  Pointer of the substitution lookup table.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static void
+present_avx2_init(present_avx2_const_t * p_const, uint8_t const * p_sbox);
+
+/**
+ * @brief Runs the substitution and the permutation layers on a register.
+ *
+ * @param[in] x       Register of the text blocks.
+ * @param[in] p_const Pointer of the engine constants.
+ *
+ * @return Register of the text blocks after the layers.
+ */
+PRESENT_AVX2 static PRESENT_INLINE __m256i
+present_avx2_layers(__m256i x, present_avx2_const_t const * p_const);
+
+/**
+ * @brief Runs the inverse permutation and substitution layers on a register.
+ *
+ * @param[in] x       Register of the text blocks.
+ * @param[in] p_const Pointer of the engine constants.
+ *
+ * @return Register of the text blocks after the layers.
+ */
+PRESENT_AVX2 static PRESENT_INLINE __m256i
+present_avx2_layers_inv(__m256i x, present_avx2_const_t const * p_const);
+
+/**
+ * @brief Runs the encryption on the registers.
+ *
+ * The function encrypts the text blocks in the first \p ways registers of
+ * \p p_state.
+ *
+ * @param[in]     p_ctx   Pointer of the crypt context.
+ * @param[in]     p_const Pointer of the engine constants.
+ * @param[in,out] p_state Pointer of the registers.
+ * @param[in]     ways    Count of the registers.
+ * @param[in]     rounds  Count of the rounds.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_encrypt(present_ctx_t const * p_ctx, \
+                     present_avx2_const_t const * p_const, \
+                     __m256i * p_state, uint8_t ways, uint8_t rounds);
+
+/**
+ * @brief Runs the decryption on the registers.
+ *
+ * The function decrypts the text blocks in the first \p ways registers of
+ * \p p_state.
+ *
+ * @param[in]     p_ctx   Pointer of the crypt context.
+ * @param[in]     p_const Pointer of the engine constants.
+ * @param[in,out] p_state Pointer of the registers.
+ * @param[in]     ways    Count of the registers.
+ * @param[in]     rounds  Count of the rounds.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_decrypt(present_ctx_t const * p_ctx, \
+                     present_avx2_const_t const * p_const, \
+                     __m256i * p_state, uint8_t ways, uint8_t rounds);
+
+/**
+ * @brief Encrypts consecutive text blocks with the AVX2 engine.
+ *
+ * The function is the multi-block encryption function of the AVX2 engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the crypted text buffer.
+ * @param[in]  p_src Pointer of the raw text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static void
+present_avx2_encrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with the AVX2 engine.
+ *
+ * The function is the multi-block decryption function of the AVX2 engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the raw text buffer.
+ * @param[in]  p_src Pointer of the crypted text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static void
+present_avx2_decrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Runs the encryption on the registers with a key per lane.
+ *
+ * The function encrypts the text blocks in the first \p ways registers of
+ * \p p_state. Lane i of the registers is encrypted with the context
+ * pointed by \p pp_ctx[i].
+ *
+ * @param[in]     pp_ctx  Pointer of the crypt contexts of the lanes.
+ * @param[in]     p_const Pointer of the engine constants.
+ * @param[in,out] p_state Pointer of the registers.
+ * @param[in]     ways    Count of the registers.
+ * @param[in]     rounds  Count of the rounds.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_encrypt_multi(present_ctx_t const * const * pp_ctx, \
+                           present_avx2_const_t const * p_const, \
+                           __m256i * p_state, uint8_t ways, uint8_t rounds);
+
+/**
+ * @brief Runs the decryption on the registers with a key per lane.
+ *
+ * The function decrypts the text blocks in the first \p ways registers of
+ * \p p_state. Lane i of the registers is decrypted with the context
+ * pointed by \p pp_ctx[i].
+ *
+ * @param[in]     pp_ctx  Pointer of the crypt contexts of the lanes.
+ * @param[in]     p_const Pointer of the engine constants.
+ * @param[in,out] p_state Pointer of the registers.
+ * @param[in]     ways    Count of the registers.
+ * @param[in]     rounds  Count of the rounds.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_decrypt_multi(present_ctx_t const * const * pp_ctx, \
+                           present_avx2_const_t const * p_const, \
+                           __m256i * p_state, uint8_t ways, uint8_t rounds);
+
+/**
+ * @brief Encrypts consecutive text blocks with different keys.
+ *
+ * The function is the multi-key encryption function of the AVX2 engine.
+ *
+ * @param[in]  pp_ctx Pointer of the crypt contexts of the blocks.
+ * @param[out] p_dst  Pointer of the crypted text buffer.
+ * @param[in]  p_src  Pointer of the raw text buffer.
+ * @param[in]  count  Count of the blocks.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static void
+present_avx2_encrypt_multi_blocks(present_ctx_t const * const * pp_ctx, \
+                                  uint8_t * p_dst, uint8_t const * p_src, \
+                                  size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with different keys.
+ *
+ * The function is the multi-key decryption function of the AVX2 engine.
+ *
+ * @param[in]  pp_ctx Pointer of the crypt contexts of the blocks.
+ * @param[out] p_dst  Pointer of the raw text buffer.
+ * @param[in]  p_src  Pointer of the crypted text buffer.
+ * @param[in]  count  Count of the blocks.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static void
+present_avx2_decrypt_multi_blocks(present_ctx_t const * const * pp_ctx, \
+                                  uint8_t * p_dst, uint8_t const * p_src, \
+                                  size_t count);
+
+/**
+ * @brief Stores a round key of the lanes to their contexts.
+ *
+ * The function stores the round key of every lane of \p key to the
+ * context of the lane, together with the round key moved by the inverse
+ * permutation layer.
+ *
+ * @param[out] p_ctx   Pointer of the contexts of the lanes.
+ * @param[in]  p_const Pointer of the engine constants.
+ * @param[in]  key     Register of the round keys.
+ * @param[in]  round   Index of the round key.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_store_key(present_ctx_t * p_ctx, \
+                       present_avx2_const_t const * p_const, __m256i key, \
+                       uint8_t round);
+
+/**
+ * @brief Runs the 80-bit key schedule of the keys in the lanes.
+ *
+ * @param[out] p_ctx   Pointer of the contexts of the lanes.
+ * @param[in]  p_keys  Pointer of the keys of the lanes.
+ * @param[in]  p_const Pointer of the engine constants.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static void
+present_avx2_key_schedule80(present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                            present_avx2_const_t const * p_const);
+
+/**
+ * @brief Runs the 128-bit key schedule of the keys in the lanes.
+ *
+ * @param[out] p_ctx   Pointer of the contexts of the lanes.
+ * @param[in]  p_keys  Pointer of the keys of the lanes.
+ * @param[in]  p_const Pointer of the engine constants.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static void
+present_avx2_key_schedule128(present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                             present_avx2_const_t const * p_const);
+
+/**
+ * @brief Expands a batch of keys with the AVX2 engine.
+ *
+ * The function is the batch key setup function of the AVX2 engine.
+ *
+ * @param[out] p_ctx    Pointer of the crypt contexts.
+ * @param[in]  p_keys   Pointer of the crypt keys.
+ * @param[in]  key_size Size of a key in byte.
+ * @param[in]  count    Count of the keys.
+ *
+ * @return None.
+ */
+PRESENT_AVX2 static void
+present_avx2_key_setup(present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                       size_t key_size, size_t count);
+
+/*****************************************************************************/
+/* ENGINE DEFINITIONS                                                        */
+/*****************************************************************************/
+
+present_engine_t const g_present_engine_ssse3 = {
+    "ssse3",
+    CPU_FEATURE_SSSE3,
+    present_ssse3_encrypt_blocks,
+    present_ssse3_decrypt_blocks,
+    present_ssse3_encrypt_multi_blocks,
+    present_ssse3_decrypt_multi_blocks,
+    present_ssse3_key_setup
+};
+
+present_engine_t const g_present_engine_avx2 = {
+    "avx2",
+    CPU_FEATURE_AVX2,
+    present_avx2_encrypt_blocks,
+    present_avx2_decrypt_blocks,
+    present_avx2_encrypt_multi_blocks,
+    present_avx2_decrypt_multi_blocks,
+    present_avx2_key_setup
+};
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+PRESENT_SSSE3 static void
+present_ssse3_init (present_ssse3_const_t * p_const, uint8_t const * p_sbox)
+{
+    p_const->low    = _mm_loadu_si128((__m128i const *)p_sbox);
+    p_const->high   = _mm_slli_epi16(p_const->low, 4);
+    p_const->nibble = _mm_set1_epi8(0x0F);
+
+    p_const->perm[0] = _mm_set1_epi64x((long long)PRESENT_PERM_MASK_1);
+    p_const->perm[1] = _mm_set1_epi64x((long long)PRESENT_PERM_MASK_2);
+    p_const->perm[2] = _mm_set1_epi64x((long long)PRESENT_PERM_MASK_3);
+    p_const->perm[3] = _mm_set1_epi64x((long long)PRESENT_PERM_MASK_4);
+}  /* present_ssse3_init() */
+
+PRESENT_SSSE3 static PRESENT_INLINE __m128i
+present_ssse3_layers (__m128i x, present_ssse3_const_t const * p_const)
+{
+    __m128i low;
+    __m128i high;
+
+    /*
+     * Substitute the low and the high nibbles of every byte.
+     */
+    low  = _mm_and_si128(x, p_const->nibble);
+    high = _mm_and_si128(_mm_srli_epi16(x, 4), p_const->nibble);
+
+    x = _mm_or_si128(_mm_shuffle_epi8(p_const->low, low), \
+                     _mm_shuffle_epi8(p_const->high, high));
+
+    PRESENT_SSSE3_SWAP(x, p_const->perm[0], PRESENT_PERM_DELTA_1);
+    PRESENT_SSSE3_SWAP(x, p_const->perm[1], PRESENT_PERM_DELTA_2);
+    PRESENT_SSSE3_SWAP(x, p_const->perm[2], PRESENT_PERM_DELTA_3);
+    PRESENT_SSSE3_SWAP(x, p_const->perm[3], PRESENT_PERM_DELTA_4);
+
+    return x;
+}  /* present_ssse3_layers() */
+
+PRESENT_SSSE3 static PRESENT_INLINE __m128i
+present_ssse3_layers_inv (__m128i x, present_ssse3_const_t const * p_const)
+{
+    __m128i low;
+    __m128i high;
+
+    PRESENT_SSSE3_SWAP(x, p_const->perm[3], PRESENT_PERM_DELTA_4);
+    PRESENT_SSSE3_SWAP(x, p_const->perm[2], PRESENT_PERM_DELTA_3);
+    PRESENT_SSSE3_SWAP(x, p_const->perm[1], PRESENT_PERM_DELTA_2);
+    PRESENT_SSSE3_SWAP(x, p_const->perm[0], PRESENT_PERM_DELTA_1);
+
+    /*
+     * Inverse substitute the low and the high nibbles of every byte.
+     */
+    low  = _mm_and_si128(x, p_const->nibble);
+    high = _mm_and_si128(_mm_srli_epi16(x, 4), p_const->nibble);
+
+    return _mm_or_si128(_mm_shuffle_epi8(p_const->low, low), \
+                        _mm_shuffle_epi8(p_const->high, high));
+}  /* present_ssse3_layers_inv() */
+
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_encrypt (present_ctx_t const * p_ctx, \
+                       present_ssse3_const_t const * p_const, \
+                       __m128i * p_state, uint8_t ways, uint8_t rounds)
+{
+    __m128i key;
+    uint8_t round;
+    uint8_t way;
+
+    for (round = 0u; round < rounds; round++)
+    {
+        key = _mm_set1_epi64x((long long)p_ctx->round_key[round]);
+
+        for (way = 0u; way < ways; way++)
+        {
+            p_state[way] = _mm_xor_si128(p_state[way], key);
+            p_state[way] = present_ssse3_layers(p_state[way], p_const);
+        }
+    }
+
+    key = _mm_set1_epi64x((long long)p_ctx->round_key[rounds]);
+
+    for (way = 0u; way < ways; way++)
+    {
+        p_state[way] = _mm_xor_si128(p_state[way], key);
+    }
+}  /* present_ssse3_encrypt() */
+
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_decrypt (present_ctx_t const * p_ctx, \
+                       present_ssse3_const_t const * p_const, \
+                       __m128i * p_state, uint8_t ways, uint8_t rounds)
+{
+    __m128i key;
+    uint8_t round;
+    uint8_t way;
+
+    key = _mm_set1_epi64x((long long)p_ctx->round_key[rounds]);
+
+    for (way = 0u; way < ways; way++)
+    {
+        p_state[way] = _mm_xor_si128(p_state[way], key);
+    }
+
+    for (round = rounds; round > 0u; round--)
+    {
+        key = _mm_set1_epi64x((long long)p_ctx->round_key[round - 1u]);
+
+        for (way = 0u; way < ways; way++)
+        {
+            p_state[way] = present_ssse3_layers_inv(p_state[way], p_const);
+            p_state[way] = _mm_xor_si128(p_state[way], key);
+        }
+    }
+}  /* present_ssse3_decrypt() */
+
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_encrypt_multi (present_ctx_t const * const * pp_ctx, \
+                             present_ssse3_const_t const * p_const, \
+                             __m128i * p_state, uint8_t ways, uint8_t rounds)
+{
+    __m128i key;
+    uint8_t round;
+    uint8_t way;
+
+    for (round = 0u; round < rounds; round++)
+    {
+        for (way = 0u; way < ways; way++)
+        {
+            key = _mm_set_epi64x( \
+                      (long long)pp_ctx[2u * way + 1u]->round_key[round], \
+                      (long long)pp_ctx[2u * way]->round_key[round]);
+
+            p_state[way] = _mm_xor_si128(p_state[way], key);
+            p_state[way] = present_ssse3_layers(p_state[way], p_const);
+        }
+    }
+
+    for (way = 0u; way < ways; way++)
+    {
+        key = _mm_set_epi64x( \
+                  (long long)pp_ctx[2u * way + 1u]->round_key[rounds], \
+                  (long long)pp_ctx[2u * way]->round_key[rounds]);
+
+        p_state[way] = _mm_xor_si128(p_state[way], key);
+    }
+}  /* present_ssse3_encrypt_multi() */
+
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_decrypt_multi (present_ctx_t const * const * pp_ctx, \
+                             present_ssse3_const_t const * p_const, \
+                             __m128i * p_state, uint8_t ways, uint8_t rounds)
+{
+    __m128i key;
+    uint8_t round;
+    uint8_t way;
+
+    for (way = 0u; way < ways; way++)
+    {
+        key = _mm_set_epi64x( \
+                  (long long)pp_ctx[2u * way + 1u]->round_key[rounds], \
+                  (long long)pp_ctx[2u * way]->round_key[rounds]);
+
+        p_state[way] = _mm_xor_si128(p_state[way], key);
+    }
+
+    /*
+     * The round counter wraps around after the first round key.
+     */
+    for (round = rounds - 1u; round < rounds; round--)
+    {
+        for (way = 0u; way < ways; way++)
+        {
+            key = _mm_set_epi64x( \
+                      (long long)pp_ctx[2u * way + 1u]->round_key[round], \
+                      (long long)pp_ctx[2u * way]->round_key[round]);
+
+            p_state[way] = present_ssse3_layers_inv(p_state[way], p_const);
+            p_state[way] = _mm_xor_si128(p_state[way], key);
+        }
+    }
+}  /* present_ssse3_decrypt_multi() */
+
+PRESENT_SSSE3 static void
+present_ssse3_encrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                              uint8_t const * p_src, size_t count)
+{
+    present_ssse3_const_t consts;
+    __m128i               state[PRESENT_SIMD_WAYS];
+    uint8_t               ways;
+    uint8_t               way;
+
+    ASSERT(NULL != p_ctx);
+
+    present_ssse3_init(&consts, g_sbox);
+
+    while (count >= PRESENT_SSSE3_LANES)
+    {
+        /*
+         * Fill as many registers as possible to hide the latency.
+         */
+        ways = (count >= PRESENT_SIMD_WAYS * PRESENT_SSSE3_LANES) \
+               ? PRESENT_SIMD_WAYS : (uint8_t)(count / PRESENT_SSSE3_LANES);
+
+        for (way = 0u; way < ways; way++)
+        {
+            state[way] = _mm_loadu_si128((__m128i const *)p_src + way);
+        }
+
+        /*
+         * Pass the default round count as a constant to specialize the
+         * inlined rounds for it.
+         */
+        if (PRESENT_ROUND_COUNT == p_ctx->rounds)
+        {
+            present_ssse3_encrypt(p_ctx, &consts, state, ways, \
+                                  PRESENT_ROUND_COUNT);
+        }
+        else
+        {
+            present_ssse3_encrypt(p_ctx, &consts, state, ways, p_ctx->rounds);
+        }
+
+        for (way = 0u; way < ways; way++)
+        {
+            _mm_storeu_si128((__m128i *)p_dst + way, state[way]);
+        }
+
+        p_dst += ways * PRESENT_SSSE3_LANES * PRESENT_CRYPT_SIZE;
+        p_src += ways * PRESENT_SSSE3_LANES * PRESENT_CRYPT_SIZE;
+        count -= ways * PRESENT_SSSE3_LANES;
+    }
+
+    g_present_engine_table.encrypt(p_ctx, p_dst, p_src, count);
+}  /* present_ssse3_encrypt_blocks() */
+
+PRESENT_SSSE3 static void
+present_ssse3_decrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                              uint8_t const * p_src, size_t count)
+{
+    present_ssse3_const_t consts;
+    __m128i               state[PRESENT_SIMD_WAYS];
+    uint8_t               ways;
+    uint8_t               way;
+
+    ASSERT(NULL != p_ctx);
+
+    present_ssse3_init(&consts, g_sbox_inv);
+
+    while (count >= PRESENT_SSSE3_LANES)
+    {
+        /*
+         * Fill as many registers as possible to hide the latency.
+         */
+        ways = (count >= PRESENT_SIMD_WAYS * PRESENT_SSSE3_LANES) \
+               ? PRESENT_SIMD_WAYS : (uint8_t)(count / PRESENT_SSSE3_LANES);
+
+        for (way = 0u; way < ways; way++)
+        {
+            state[way] = _mm_loadu_si128((__m128i const *)p_src + way);
+        }
+
+        if (PRESENT_ROUND_COUNT == p_ctx->rounds)
+        {
+            present_ssse3_decrypt(p_ctx, &consts, state, ways, \
+                                  PRESENT_ROUND_COUNT);
+        }
+        else
+        {
+            present_ssse3_decrypt(p_ctx, &consts, state, ways, p_ctx->rounds);
+        }
+
+        for (way = 0u; way < ways; way++)
+        {
+            _mm_storeu_si128((__m128i *)p_dst + way, state[way]);
+        }
+
+        p_dst += ways * PRESENT_SSSE3_LANES * PRESENT_CRYPT_SIZE;
+        p_src += ways * PRESENT_SSSE3_LANES * PRESENT_CRYPT_SIZE;
+        count -= ways * PRESENT_SSSE3_LANES;
+    }
+
+    g_present_engine_table.decrypt(p_ctx, p_dst, p_src, count);
+}  /* present_ssse3_decrypt_blocks() */
+
+PRESENT_SSSE3 static void
+present_ssse3_encrypt_multi_blocks (present_ctx_t const * const * pp_ctx, \
+                                    uint8_t * p_dst, uint8_t const * p_src, \
+                                    size_t count)
+{
+    present_ssse3_const_t consts;
+    __m128i               state[PRESENT_SIMD_WAYS];
+    uint8_t               rounds;
+    uint8_t               ways;
+    uint8_t               way;
+
+    ASSERT((NULL != pp_ctx) || (0u == count));
+
+    present_ssse3_init(&consts, g_sbox);
+
+    while (count >= PRESENT_SSSE3_LANES)
+    {
+        ways = (count >= PRESENT_SIMD_WAYS * PRESENT_SSSE3_LANES) \
+               ? PRESENT_SIMD_WAYS : (uint8_t)(count / PRESENT_SSSE3_LANES);
+        rounds = pp_ctx[0]->rounds;
+
+        for (way = 0u; way < ways; way++)
+        {
+            state[way] = _mm_loadu_si128((__m128i const *)p_src + way);
+        }
+
+        if (PRESENT_ROUND_COUNT == rounds)
+        {
+            present_ssse3_encrypt_multi(pp_ctx, &consts, state, ways, \
+                                        PRESENT_ROUND_COUNT);
+        }
+        else
+        {
+            present_ssse3_encrypt_multi(pp_ctx, &consts, state, ways, rounds);
+        }
+
+        for (way = 0u; way < ways; way++)
+        {
+            _mm_storeu_si128((__m128i *)p_dst + way, state[way]);
+        }
+
+        pp_ctx += ways * PRESENT_SSSE3_LANES;
+        p_dst  += ways * PRESENT_SSSE3_LANES * PRESENT_CRYPT_SIZE;
+        p_src  += ways * PRESENT_SSSE3_LANES * PRESENT_CRYPT_SIZE;
+        count  -= ways * PRESENT_SSSE3_LANES;
+    }
+
+    for (; count > 0u; count--)
+    {
+        g_present_engine_table.encrypt(*pp_ctx, p_dst, p_src, 1u);
+
+        pp_ctx++;
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+    }
+}  /* present_ssse3_encrypt_multi_blocks() */
+
+PRESENT_SSSE3 static void
+present_ssse3_decrypt_multi_blocks (present_ctx_t const * const * pp_ctx, \
+                                    uint8_t * p_dst, uint8_t const * p_src, \
+                                    size_t count)
+{
+    present_ssse3_const_t consts;
+    __m128i               state[PRESENT_SIMD_WAYS];
+    uint8_t               rounds;
+    uint8_t               ways;
+    uint8_t               way;
+
+    ASSERT((NULL != pp_ctx) || (0u == count));
+
+    present_ssse3_init(&consts, g_sbox_inv);
+
+    while (count >= PRESENT_SSSE3_LANES)
+    {
+        ways = (count >= PRESENT_SIMD_WAYS * PRESENT_SSSE3_LANES) \
+               ? PRESENT_SIMD_WAYS : (uint8_t)(count / PRESENT_SSSE3_LANES);
+        rounds = pp_ctx[0]->rounds;
+
+        for (way = 0u; way < ways; way++)
+        {
+            state[way] = _mm_loadu_si128((__m128i const *)p_src + way);
+        }
+
+        if (PRESENT_ROUND_COUNT == rounds)
+        {
+            present_ssse3_decrypt_multi(pp_ctx, &consts, state, ways, \
+                                        PRESENT_ROUND_COUNT);
+        }
+        else
+        {
+            present_ssse3_decrypt_multi(pp_ctx, &consts, state, ways, rounds);
+        }
+
+        for (way = 0u; way < ways; way++)
+        {
+            _mm_storeu_si128((__m128i *)p_dst + way, state[way]);
+        }
+
+        pp_ctx += ways * PRESENT_SSSE3_LANES;
+        p_dst  += ways * PRESENT_SSSE3_LANES * PRESENT_CRYPT_SIZE;
+        p_src  += ways * PRESENT_SSSE3_LANES * PRESENT_CRYPT_SIZE;
+        count  -= ways * PRESENT_SSSE3_LANES;
+    }
+
+    for (; count > 0u; count--)
+    {
+        g_present_engine_table.decrypt(*pp_ctx, p_dst, p_src, 1u);
+
+        pp_ctx++;
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+    }
+}  /* present_ssse3_decrypt_multi_blocks() */
+
+PRESENT_SSSE3 static PRESENT_INLINE void
+present_ssse3_store_key (present_ctx_t * p_ctx, \
+                         present_ssse3_const_t const * p_const, __m128i key, \
+                         uint8_t round)
+{
+    uint64_t lanes[PRESENT_SSSE3_LANES];
+    uint8_t  lane;
+
+    _mm_storeu_si128((__m128i *)lanes, key);
+
+    for (lane = 0u; lane < PRESENT_SSSE3_LANES; lane++)
+    {
+        p_ctx[lane].round_key[round] = lanes[lane];
+    }
+
+    PRESENT_SSSE3_SWAP(key, p_const->perm[3], PRESENT_PERM_DELTA_4);
+    PRESENT_SSSE3_SWAP(key, p_const->perm[2], PRESENT_PERM_DELTA_3);
+    PRESENT_SSSE3_SWAP(key, p_const->perm[1], PRESENT_PERM_DELTA_2);
+    PRESENT_SSSE3_SWAP(key, p_const->perm[0], PRESENT_PERM_DELTA_1);
+
+    _mm_storeu_si128((__m128i *)lanes, key);
+
+    for (lane = 0u; lane < PRESENT_SSSE3_LANES; lane++)
+    {
+        p_ctx[lane].inv_round_key[round] = lanes[lane];
+    }
+}  /* present_ssse3_store_key() */
+
+PRESENT_SSSE3 static void
+present_ssse3_key_schedule80 (present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                              present_ssse3_const_t const * p_const)
+{
+    uint64_t        lanes[2u][PRESENT_SSSE3_LANES];
+    __m128i         nibble = _mm_set1_epi64x(0x0F);
+    __m128i         mask16 = _mm_set1_epi64x(PRESENT_KEY80_HIGH_MASK);
+    __m128i         mask12 = _mm_set1_epi64x(0x0FFF);
+    uint8_t const * p_key;
+    __m128i         low;
+    __m128i         high;
+    __m128i         rotated;
+    __m128i         counter;
+    __m128i         sbox;
+    uint8_t         round;
+    uint8_t         lane;
+
+    for (lane = 0u; lane < PRESENT_SSSE3_LANES; lane++)
+    {
+        p_key          = &p_keys[lane * PRESENT_KEY80_SIZE];
+        lanes[0][lane] = present_load64(p_key);
+        lanes[1][lane] = (uint64_t)p_key[8] | ((uint64_t)p_key[9] << 8);
+    }
+
+    low  = _mm_loadu_si128((__m128i const *)lanes[0]);
+    high = _mm_loadu_si128((__m128i const *)lanes[1]);
+
+    for (round = 1u; round <= PRESENT_ROUND_COUNT_MAX; round++)
+    {
+        rotated = _mm_or_si128(_mm_slli_epi64(high, 48), \
+                               _mm_srli_epi64(low, 16));
+        present_ssse3_store_key(p_ctx, p_const, rotated, \
+                                (uint8_t)(round - 1u));
+
+        rotated = _mm_or_si128(_mm_srli_epi64(low, 19), \
+                               _mm_slli_epi64(high, 45));
+        rotated = _mm_or_si128(rotated, _mm_slli_epi64(low, 61));
+        high    = _mm_and_si128(_mm_srli_epi64(low, 3), mask16);
+        low     = rotated;
+
+        /*
+         * The most significant nibble is the lowest byte of its lane after
+         * the shift, so a shuffle substitutes it.
+         */
+        sbox = _mm_shuffle_epi8(p_const->low, _mm_srli_epi64(high, 12));
+        sbox = _mm_and_si128(sbox, nibble);
+        high = _mm_or_si128(_mm_and_si128(high, mask12), \
+                            _mm_slli_epi64(sbox, 12));
+
+        counter = _mm_set1_epi64x((long long)round << 15);
+        low     = _mm_xor_si128(low, counter);
+    }
+
+    rotated = _mm_or_si128(_mm_slli_epi64(high, 48), \
+                           _mm_srli_epi64(low, 16));
+    present_ssse3_store_key(p_ctx, p_const, rotated, PRESENT_ROUND_COUNT_MAX);
+}  /* present_ssse3_key_schedule80() */
+
+PRESENT_SSSE3 static void
+present_ssse3_key_schedule128 (present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                               present_ssse3_const_t const * p_const)
+{
+    uint64_t lanes[2u][PRESENT_SSSE3_LANES];
+    __m128i  nibble = _mm_set1_epi64x(0x0F);
+    __m128i  mask56 = _mm_set1_epi64x(0x00FFFFFFFFFFFFFFLL);
+    __m128i  low;
+    __m128i  high;
+    __m128i  rotated;
+    __m128i  counter;
+    __m128i  sbox;
+    uint8_t  round;
+    uint8_t  lane;
+
+    for (lane = 0u; lane < PRESENT_SSSE3_LANES; lane++)
+    {
+        lanes[0][lane] = present_load64(&p_keys[lane * PRESENT_KEY128_SIZE]);
+        lanes[1][lane] = present_load64(&p_keys[lane * PRESENT_KEY128_SIZE \
+                                                + PRESENT_CRYPT_SIZE]);
+    }
+
+    low  = _mm_loadu_si128((__m128i const *)lanes[0]);
+    high = _mm_loadu_si128((__m128i const *)lanes[1]);
+
+    for (round = 1u; round <= PRESENT_ROUND_COUNT_MAX; round++)
+    {
+        present_ssse3_store_key(p_ctx, p_const, high, (uint8_t)(round - 1u));
+
+        rotated = _mm_or_si128(_mm_srli_epi64(low, 3), \
+                               _mm_slli_epi64(high, 61));
+        low     = _mm_or_si128(_mm_srli_epi64(high, 3), \
+                               _mm_slli_epi64(low, 61));
+        high    = rotated;
+
+        /*
+         * Substitute the two most significant nibbles by moving each of
+         * them to the lowest byte of its lane.
+         */
+        sbox    = _mm_srli_epi64(high, 60);
+        sbox    = _mm_shuffle_epi8(p_const->low, sbox);
+        rotated = _mm_slli_epi64(_mm_and_si128(sbox, nibble), 60);
+        sbox    = _mm_and_si128(_mm_srli_epi64(high, 56), nibble);
+        sbox    = _mm_shuffle_epi8(p_const->low, sbox);
+        sbox    = _mm_slli_epi64(_mm_and_si128(sbox, nibble), 56);
+        high    = _mm_or_si128(_mm_and_si128(high, mask56), \
+                               _mm_or_si128(rotated, sbox));
+
+        counter = _mm_set1_epi64x(round >> 2);
+        high    = _mm_xor_si128(high, counter);
+        counter = _mm_set1_epi64x((long long)round << 62);
+        low     = _mm_xor_si128(low, counter);
+    }
+
+    present_ssse3_store_key(p_ctx, p_const, high, PRESENT_ROUND_COUNT_MAX);
+}  /* present_ssse3_key_schedule128() */
+
+PRESENT_SSSE3 static void
+present_ssse3_key_setup (present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                         size_t key_size, size_t count)
+{
+    present_ssse3_const_t consts;
+    uint8_t               lane;
+
+    ASSERT((NULL != p_ctx) || (0u == count));
+
+    present_ssse3_init(&consts, g_sbox);
+
+    for (; count >= PRESENT_SSSE3_LANES; count -= PRESENT_SSSE3_LANES)
+    {
+        if (PRESENT_KEY80_SIZE == key_size)
+        {
+            present_ssse3_key_schedule80(p_ctx, p_keys, &consts);
+        }
+        else
+        {
+            present_ssse3_key_schedule128(p_ctx, p_keys, &consts);
+        }
+
+        for (lane = 0u; lane < PRESENT_SSSE3_LANES; lane++)
+        {
+            p_ctx[lane].rounds = PRESENT_ROUND_COUNT;
+        }
+
+        p_ctx  += PRESENT_SSSE3_LANES;
+        p_keys += PRESENT_SSSE3_LANES * key_size;
+    }
+
+    for (; count > 0u; count--)
+    {
+        present_key_setup(p_ctx, p_keys, key_size);
+
+        p_ctx++;
+        p_keys += key_size;
+    }
+}  /* present_ssse3_key_setup() */
+
+PRESENT_AVX2 static void
+present_avx2_init (present_avx2_const_t * p_const, uint8_t const * p_sbox)
+{
+    p_const->low = _mm256_broadcastsi128_si256( \
+                       _mm_loadu_si128((__m128i const *)p_sbox));
+    p_const->high   = _mm256_slli_epi16(p_const->low, 4);
+    p_const->nibble = _mm256_set1_epi8(0x0F);
+
+    p_const->perm[0] = _mm256_set1_epi64x((long long)PRESENT_PERM_MASK_1);
+    p_const->perm[1] = _mm256_set1_epi64x((long long)PRESENT_PERM_MASK_2);
+    p_const->perm[2] = _mm256_set1_epi64x((long long)PRESENT_PERM_MASK_3);
+    p_const->perm[3] = _mm256_set1_epi64x((long long)PRESENT_PERM_MASK_4);
+}  /* present_avx2_init() */
+
+PRESENT_AVX2 static PRESENT_INLINE __m256i
+present_avx2_layers (__m256i x, present_avx2_const_t const * p_const)
+{
+    __m256i low;
+    __m256i high;
+
+    /*
+     * Substitute the low and the high nibbles of every byte.
+     */
+    low  = _mm256_and_si256(x, p_const->nibble);
+    high = _mm256_and_si256(_mm256_srli_epi16(x, 4), p_const->nibble);
+
+    x = _mm256_or_si256(_mm256_shuffle_epi8(p_const->low, low), \
+                        _mm256_shuffle_epi8(p_const->high, high));
+
+    PRESENT_AVX2_SWAP(x, p_const->perm[0], PRESENT_PERM_DELTA_1);
+    PRESENT_AVX2_SWAP(x, p_const->perm[1], PRESENT_PERM_DELTA_2);
+    PRESENT_AVX2_SWAP(x, p_const->perm[2], PRESENT_PERM_DELTA_3);
+    PRESENT_AVX2_SWAP(x, p_const->perm[3], PRESENT_PERM_DELTA_4);
+
+    return x;
+}  /* present_avx2_layers() */
+
+PRESENT_AVX2 static PRESENT_INLINE __m256i
+present_avx2_layers_inv (__m256i x, present_avx2_const_t const * p_const)
+{
+    __m256i low;
+    __m256i high;
+
+    PRESENT_AVX2_SWAP(x, p_const->perm[3], PRESENT_PERM_DELTA_4);
+    PRESENT_AVX2_SWAP(x, p_const->perm[2], PRESENT_PERM_DELTA_3);
+    PRESENT_AVX2_SWAP(x, p_const->perm[1], PRESENT_PERM_DELTA_2);
+    PRESENT_AVX2_SWAP(x, p_const->perm[0], PRESENT_PERM_DELTA_1);
+
+    /*
+     * Inverse substitute the low and the high nibbles of every byte.
+     */
+    low  = _mm256_and_si256(x, p_const->nibble);
+    high = _mm256_and_si256(_mm256_srli_epi16(x, 4), p_const->nibble);
+
+    return _mm256_or_si256(_mm256_shuffle_epi8(p_const->low, low), \
+                           _mm256_shuffle_epi8(p_const->high, high));
+}  /* present_avx2_layers_inv() */
+
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_encrypt (present_ctx_t const * p_ctx, \
+                      present_avx2_const_t const * p_const, \
+                      __m256i * p_state, uint8_t ways, uint8_t rounds)
+{
+    __m256i key;
+    uint8_t round;
+    uint8_t way;
+
+    for (round = 0u; round < rounds; round++)
+    {
+        key = _mm256_set1_epi64x((long long)p_ctx->round_key[round]);
+
+        for (way = 0u; way < ways; way++)
+        {
+            p_state[way] = _mm256_xor_si256(p_state[way], key);
+            p_state[way] = present_avx2_layers(p_state[way], p_const);
+        }
+    }
+
+    key = _mm256_set1_epi64x((long long)p_ctx->round_key[rounds]);
+
+    for (way = 0u; way < ways; way++)
+    {
+        p_state[way] = _mm256_xor_si256(p_state[way], key);
+    }
+}  /* present_avx2_encrypt() */
+
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_decrypt (present_ctx_t const * p_ctx, \
+                      present_avx2_const_t const * p_const, \
+                      __m256i * p_state, uint8_t ways, uint8_t rounds)
+{
+    __m256i key;
+    uint8_t round;
+    uint8_t way;
+
+    key = _mm256_set1_epi64x((long long)p_ctx->round_key[rounds]);
+
+    for (way = 0u; way < ways; way++)
+    {
+        p_state[way] = _mm256_xor_si256(p_state[way], key);
+    }
+
+    for (round = rounds; round > 0u; round--)
+    {
+        key = _mm256_set1_epi64x((long long)p_ctx->round_key[round - 1u]);
+
+        for (way = 0u; way < ways; way++)
+        {
+            p_state[way] = present_avx2_layers_inv(p_state[way], p_const);
+            p_state[way] = _mm256_xor_si256(p_state[way], key);
+        }
+    }
+}  /* present_avx2_decrypt() */
+
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_encrypt_multi (present_ctx_t const * const * pp_ctx, \
+                            present_avx2_const_t const * p_const, \
+                            __m256i * p_state, uint8_t ways, uint8_t rounds)
+{
+    __m256i key;
+    uint8_t round;
+    uint8_t way;
+
+    for (round = 0u; round < rounds; round++)
+    {
+        for (way = 0u; way < ways; way++)
+        {
+            key = _mm256_set_epi64x( \
+                      (long long)pp_ctx[4u * way + 3u]->round_key[round], \
+                      (long long)pp_ctx[4u * way + 2u]->round_key[round], \
+                      (long long)pp_ctx[4u * way + 1u]->round_key[round], \
+                      (long long)pp_ctx[4u * way]->round_key[round]);
+
+            p_state[way] = _mm256_xor_si256(p_state[way], key);
+            p_state[way] = present_avx2_layers(p_state[way], p_const);
+        }
+    }
+
+    for (way = 0u; way < ways; way++)
+    {
+        key = _mm256_set_epi64x( \
+                  (long long)pp_ctx[4u * way + 3u]->round_key[rounds], \
+                  (long long)pp_ctx[4u * way + 2u]->round_key[rounds], \
+                  (long long)pp_ctx[4u * way + 1u]->round_key[rounds], \
+                  (long long)pp_ctx[4u * way]->round_key[rounds]);
+
+        p_state[way] = _mm256_xor_si256(p_state[way], key);
+    }
+}  /* present_avx2_encrypt_multi() */
+
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_decrypt_multi (present_ctx_t const * const * pp_ctx, \
+                            present_avx2_const_t const * p_const, \
+                            __m256i * p_state, uint8_t ways, uint8_t rounds)
+{
+    __m256i key;
+    uint8_t round;
+    uint8_t way;
+
+    for (way = 0u; way < ways; way++)
+    {
+        key = _mm256_set_epi64x( \
+                  (long long)pp_ctx[4u * way + 3u]->round_key[rounds], \
+                  (long long)pp_ctx[4u * way + 2u]->round_key[rounds], \
+                  (long long)pp_ctx[4u * way + 1u]->round_key[rounds], \
+                  (long long)pp_ctx[4u * way]->round_key[rounds]);
+
+        p_state[way] = _mm256_xor_si256(p_state[way], key);
+    }
+
+    /*
+     * The round counter wraps around after the first round key.
+     */
+    for (round = rounds - 1u; round < rounds; round--)
+    {
+        for (way = 0u; way < ways; way++)
+        {
+            key = _mm256_set_epi64x( \
+                      (long long)pp_ctx[4u * way + 3u]->round_key[round], \
+                      (long long)pp_ctx[4u * way + 2u]->round_key[round], \
+                      (long long)pp_ctx[4u * way + 1u]->round_key[round], \
+                      (long long)pp_ctx[4u * way]->round_key[round]);
+
+            p_state[way] = present_avx2_layers_inv(p_state[way], p_const);
+            p_state[way] = _mm256_xor_si256(p_state[way], key);
+        }
+    }
+}  /* present_avx2_decrypt_multi() */
+
+PRESENT_AVX2 static void
+present_avx2_encrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count)
+{
+    present_avx2_const_t consts;
+    __m256i              state[PRESENT_SIMD_WAYS];
+    uint8_t              ways;
+    uint8_t              way;
+
+    ASSERT(NULL != p_ctx);
+
+    present_avx2_init(&consts, g_sbox);
+
+    while (count >= PRESENT_AVX2_LANES)
+    {
+        /*
+         * Fill as many registers as possible to hide the latency.
+         */
+        ways = (count >= PRESENT_SIMD_WAYS * PRESENT_AVX2_LANES) \
+               ? PRESENT_SIMD_WAYS : (uint8_t)(count / PRESENT_AVX2_LANES);
+
+        for (way = 0u; way < ways; way++)
+        {
+            state[way] = _mm256_loadu_si256((__m256i const *)p_src + way);
+        }
+
+        if (PRESENT_ROUND_COUNT == p_ctx->rounds)
+        {
+            present_avx2_encrypt(p_ctx, &consts, state, ways, \
+                                 PRESENT_ROUND_COUNT);
+        }
+        else
+        {
+            present_avx2_encrypt(p_ctx, &consts, state, ways, p_ctx->rounds);
+        }
+
+        for (way = 0u; way < ways; way++)
+        {
+            _mm256_storeu_si256((__m256i *)p_dst + way, state[way]);
+        }
+
+        p_dst += ways * PRESENT_AVX2_LANES * PRESENT_CRYPT_SIZE;
+        p_src += ways * PRESENT_AVX2_LANES * PRESENT_CRYPT_SIZE;
+        count -= ways * PRESENT_AVX2_LANES;
+    }
+
+    /*
+     * Use the half width registers for the remaining blocks.
+     */
+    present_ssse3_encrypt_blocks(p_ctx, p_dst, p_src, count);
+}  /* present_avx2_encrypt_blocks() */
+
+PRESENT_AVX2 static void
+present_avx2_decrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count)
+{
+    present_avx2_const_t consts;
+    __m256i              state[PRESENT_SIMD_WAYS];
+    uint8_t              ways;
+    uint8_t              way;
+
+    ASSERT(NULL != p_ctx);
+
+    present_avx2_init(&consts, g_sbox_inv);
+
+    while (count >= PRESENT_AVX2_LANES)
+    {
+        /*
+         * Fill as many registers as possible to hide the latency.
+         */
+        ways = (count >= PRESENT_SIMD_WAYS * PRESENT_AVX2_LANES) \
+               ? PRESENT_SIMD_WAYS : (uint8_t)(count / PRESENT_AVX2_LANES);
+
+        for (way = 0u; way < ways; way++)
+        {
+            state[way] = _mm256_loadu_si256((__m256i const *)p_src + way);
+        }
+
+        if (PRESENT_ROUND_COUNT == p_ctx->rounds)
+        {
+            present_avx2_decrypt(p_ctx, &consts, state, ways, \
+                                 PRESENT_ROUND_COUNT);
+        }
+        else
+        {
+            present_avx2_decrypt(p_ctx, &consts, state, ways, p_ctx->rounds);
+        }
+
+        for (way = 0u; way < ways; way++)
+        {
+            _mm256_storeu_si256((__m256i *)p_dst + way, state[way]);
+        }
+
+        p_dst += ways * PRESENT_AVX2_LANES * PRESENT_CRYPT_SIZE;
+        p_src += ways * PRESENT_AVX2_LANES * PRESENT_CRYPT_SIZE;
+        count -= ways * PRESENT_AVX2_LANES;
+    }
+
+    /*
+     * Use the half width registers for the remaining blocks.
+     */
+    present_ssse3_decrypt_blocks(p_ctx, p_dst, p_src, count);
+}  /* present_avx2_decrypt_blocks() */
+
+PRESENT_AVX2 static void
+present_avx2_encrypt_multi_blocks (present_ctx_t const * const * pp_ctx, \
+                                   uint8_t * p_dst, uint8_t const * p_src, \
+                                   size_t count)
+{
+    present_avx2_const_t consts;
+    __m256i              state[PRESENT_SIMD_WAYS];
+    uint8_t              rounds;
+    uint8_t              ways;
+    uint8_t              way;
+
+    ASSERT((NULL != pp_ctx) || (0u == count));
+
+    present_avx2_init(&consts, g_sbox);
+
+    while (count >= PRESENT_AVX2_LANES)
+    {
+        ways = (count >= PRESENT_SIMD_WAYS * PRESENT_AVX2_LANES) \
+               ? PRESENT_SIMD_WAYS : (uint8_t)(count / PRESENT_AVX2_LANES);
+        rounds = pp_ctx[0]->rounds;
+
+        for (way = 0u; way < ways; way++)
+        {
+            state[way] = _mm256_loadu_si256((__m256i const *)p_src + way);
+        }
+
+        if (PRESENT_ROUND_COUNT == rounds)
+        {
+            present_avx2_encrypt_multi(pp_ctx, &consts, state, ways, \
+                                       PRESENT_ROUND_COUNT);
+        }
+        else
+        {
+            present_avx2_encrypt_multi(pp_ctx, &consts, state, ways, rounds);
+        }
+
+        for (way = 0u; way < ways; way++)
+        {
+            _mm256_storeu_si256((__m256i *)p_dst + way, state[way]);
+        }
+
+        pp_ctx += ways * PRESENT_AVX2_LANES;
+        p_dst  += ways * PRESENT_AVX2_LANES * PRESENT_CRYPT_SIZE;
+        p_src  += ways * PRESENT_AVX2_LANES * PRESENT_CRYPT_SIZE;
+        count  -= ways * PRESENT_AVX2_LANES;
+    }
+
+    /*
+     * Use the half width registers for the remaining blocks.
+     */
+    present_ssse3_encrypt_multi_blocks(pp_ctx, p_dst, p_src, count);
+}  /* present_avx2_encrypt_multi_blocks() */
+
+PRESENT_AVX2 static void
+present_avx2_decrypt_multi_blocks (present_ctx_t const * const * pp_ctx, \
+                                   uint8_t * p_dst, uint8_t const * p_src, \
+                                   size_t count)
+{
+    present_avx2_const_t consts;
+    __m256i              state[PRESENT_SIMD_WAYS];
+    uint8_t              rounds;
+    uint8_t              ways;
+    uint8_t              way;
+
+    ASSERT((NULL != pp_ctx) || (0u == count));
+
+    present_avx2_init(&consts, g_sbox_inv);
+
+    while (count >= PRESENT_AVX2_LANES)
+    {
+        ways = (count >= PRESENT_SIMD_WAYS * PRESENT_AVX2_LANES) \
+               ? PRESENT_SIMD_WAYS : (uint8_t)(count / PRESENT_AVX2_LANES);
+        rounds = pp_ctx[0]->rounds;
+
+        for (way = 0u; way < ways; way++)
+        {
+            state[way] = _mm256_loadu_si256((__m256i const *)p_src + way);
+        }
+
+        if (PRESENT_ROUND_COUNT == rounds)
+        {
+            present_avx2_decrypt_multi(pp_ctx, &consts, state, ways, \
+                                       PRESENT_ROUND_COUNT);
+        }
+        else
+        {
+            present_avx2_decrypt_multi(pp_ctx, &consts, state, ways, rounds);
+        }
+
+        for (way = 0u; way < ways; way++)
+        {
+            _mm256_storeu_si256((__m256i *)p_dst + way, state[way]);
+        }
+
+        pp_ctx += ways * PRESENT_AVX2_LANES;
+        p_dst  += ways * PRESENT_AVX2_LANES * PRESENT_CRYPT_SIZE;
+        p_src  += ways * PRESENT_AVX2_LANES * PRESENT_CRYPT_SIZE;
+        count  -= ways * PRESENT_AVX2_LANES;
+    }
+
+    /*
+     * Use the half width registers for the remaining blocks.
+     */
+    present_ssse3_decrypt_multi_blocks(pp_ctx, p_dst, p_src, count);
+}  /* present_avx2_decrypt_multi_blocks() */
+
+PRESENT_AVX2 static PRESENT_INLINE void
+present_avx2_store_key (present_ctx_t * p_ctx, \
+                        present_avx2_const_t const * p_const, __m256i key, \
+                        uint8_t round)
+{
+    uint64_t lanes[PRESENT_AVX2_LANES];
+    uint8_t  lane;
+
+    _mm256_storeu_si256((__m256i *)lanes, key);
+
+    for (lane = 0u; lane < PRESENT_AVX2_LANES; lane++)
+    {
+        p_ctx[lane].round_key[round] = lanes[lane];
+    }
+
+    PRESENT_AVX2_SWAP(key, p_const->perm[3], PRESENT_PERM_DELTA_4);
+    PRESENT_AVX2_SWAP(key, p_const->perm[2], PRESENT_PERM_DELTA_3);
+    PRESENT_AVX2_SWAP(key, p_const->perm[1], PRESENT_PERM_DELTA_2);
+    PRESENT_AVX2_SWAP(key, p_const->perm[0], PRESENT_PERM_DELTA_1);
+
+    _mm256_storeu_si256((__m256i *)lanes, key);
+
+    for (lane = 0u; lane < PRESENT_AVX2_LANES; lane++)
+    {
+        p_ctx[lane].inv_round_key[round] = lanes[lane];
+    }
+}  /* present_avx2_store_key() */
+
+PRESENT_AVX2 static void
+present_avx2_key_schedule80 (present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                             present_avx2_const_t const * p_const)
+{
+    uint64_t        lanes[2u][PRESENT_AVX2_LANES];
+    __m256i         nibble = _mm256_set1_epi64x(0x0F);
+    __m256i         mask16 = _mm256_set1_epi64x(PRESENT_KEY80_HIGH_MASK);
+    __m256i         mask12 = _mm256_set1_epi64x(0x0FFF);
+    uint8_t const * p_key;
+    __m256i         low;
+    __m256i         high;
+    __m256i         rotated;
+    __m256i         counter;
+    __m256i         sbox;
+    uint8_t         round;
+    uint8_t         lane;
+
+    for (lane = 0u; lane < PRESENT_AVX2_LANES; lane++)
+    {
+        p_key          = &p_keys[lane * PRESENT_KEY80_SIZE];
+        lanes[0][lane] = present_load64(p_key);
+        lanes[1][lane] = (uint64_t)p_key[8] | ((uint64_t)p_key[9] << 8);
+    }
+
+    low  = _mm256_loadu_si256((__m256i const *)lanes[0]);
+    high = _mm256_loadu_si256((__m256i const *)lanes[1]);
+
+    for (round = 1u; round <= PRESENT_ROUND_COUNT_MAX; round++)
+    {
+        rotated = _mm256_or_si256(_mm256_slli_epi64(high, 48), \
+                                  _mm256_srli_epi64(low, 16));
+        present_avx2_store_key(p_ctx, p_const, rotated, \
+                               (uint8_t)(round - 1u));
+
+        rotated = _mm256_or_si256(_mm256_srli_epi64(low, 19), \
+                                  _mm256_slli_epi64(high, 45));
+        rotated = _mm256_or_si256(rotated, _mm256_slli_epi64(low, 61));
+        high    = _mm256_and_si256(_mm256_srli_epi64(low, 3), mask16);
+        low     = rotated;
+
+        /*
+         * The most significant nibble is the lowest byte of its lane after
+         * the shift, so a shuffle substitutes it.
+         */
+        sbox = _mm256_shuffle_epi8(p_const->low, _mm256_srli_epi64(high, 12));
+        sbox = _mm256_and_si256(sbox, nibble);
+        high = _mm256_or_si256(_mm256_and_si256(high, mask12), \
+                               _mm256_slli_epi64(sbox, 12));
+
+        counter = _mm256_set1_epi64x((long long)round << 15);
+        low     = _mm256_xor_si256(low, counter);
+    }
+
+    rotated = _mm256_or_si256(_mm256_slli_epi64(high, 48), \
+                              _mm256_srli_epi64(low, 16));
+    present_avx2_store_key(p_ctx, p_const, rotated, PRESENT_ROUND_COUNT_MAX);
+}  /* present_avx2_key_schedule80() */
+
+PRESENT_AVX2 static void
+present_avx2_key_schedule128 (present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                              present_avx2_const_t const * p_const)
+{
+    uint64_t lanes[2u][PRESENT_AVX2_LANES];
+    __m256i  nibble = _mm256_set1_epi64x(0x0F);
+    __m256i  mask56 = _mm256_set1_epi64x(0x00FFFFFFFFFFFFFFLL);
+    __m256i  low;
+    __m256i  high;
+    __m256i  rotated;
+    __m256i  counter;
+    __m256i  sbox;
+    uint8_t  round;
+    uint8_t  lane;
+
+    for (lane = 0u; lane < PRESENT_AVX2_LANES; lane++)
+    {
+        lanes[0][lane] = present_load64(&p_keys[lane * PRESENT_KEY128_SIZE]);
+        lanes[1][lane] = present_load64(&p_keys[lane * PRESENT_KEY128_SIZE \
+                                                + PRESENT_CRYPT_SIZE]);
+    }
+
+    low  = _mm256_loadu_si256((__m256i const *)lanes[0]);
+    high = _mm256_loadu_si256((__m256i const *)lanes[1]);
+
+    for (round = 1u; round <= PRESENT_ROUND_COUNT_MAX; round++)
+    {
+        present_avx2_store_key(p_ctx, p_const, high, (uint8_t)(round - 1u));
+
+        rotated = _mm256_or_si256(_mm256_srli_epi64(low, 3), \
+                                  _mm256_slli_epi64(high, 61));
+        low     = _mm256_or_si256(_mm256_srli_epi64(high, 3), \
+                                  _mm256_slli_epi64(low, 61));
+        high    = rotated;
+
+        /*
+         * Substitute the two most significant nibbles by moving each of
+         * them to the lowest byte of its lane.
+         */
+        sbox    = _mm256_srli_epi64(high, 60);
+        sbox    = _mm256_shuffle_epi8(p_const->low, sbox);
+        rotated = _mm256_slli_epi64(_mm256_and_si256(sbox, nibble), 60);
+        sbox    = _mm256_and_si256(_mm256_srli_epi64(high, 56), nibble);
+        sbox    = _mm256_shuffle_epi8(p_const->low, sbox);
+        sbox    = _mm256_slli_epi64(_mm256_and_si256(sbox, nibble), 56);
+        high    = _mm256_or_si256(_mm256_and_si256(high, mask56), \
+                                  _mm256_or_si256(rotated, sbox));
+
+        counter = _mm256_set1_epi64x(round >> 2);
+        high    = _mm256_xor_si256(high, counter);
+        counter = _mm256_set1_epi64x((long long)round << 62);
+        low     = _mm256_xor_si256(low, counter);
+    }
+
+    present_avx2_store_key(p_ctx, p_const, high, PRESENT_ROUND_COUNT_MAX);
+}  /* present_avx2_key_schedule128() */
+
+PRESENT_AVX2 static void
+present_avx2_key_setup (present_ctx_t * p_ctx, uint8_t const * p_keys, \
+                        size_t key_size, size_t count)
+{
+    present_avx2_const_t consts;
+    uint8_t              lane;
+
+    ASSERT((NULL != p_ctx) || (0u == count));
+
+    present_avx2_init(&consts, g_sbox);
+
+    for (; count >= PRESENT_AVX2_LANES; count -= PRESENT_AVX2_LANES)
+    {
+        if (PRESENT_KEY80_SIZE == key_size)
+        {
+            present_avx2_key_schedule80(p_ctx, p_keys, &consts);
+        }
+        else
+        {
+            present_avx2_key_schedule128(p_ctx, p_keys, &consts);
+        }
+
+        for (lane = 0u; lane < PRESENT_AVX2_LANES; lane++)
+        {
+            p_ctx[lane].rounds = PRESENT_ROUND_COUNT;
+        }
+
+        p_ctx  += PRESENT_AVX2_LANES;
+        p_keys += PRESENT_AVX2_LANES * key_size;
+    }
+
+    /*
+     * Use the half width registers for the remaining keys.
+     */
+    present_ssse3_key_setup(p_ctx, p_keys, key_size, count);
+}  /* present_avx2_key_setup() */
+
+#else  /* CPU_USE_X86 */
+
+/*
+ * The engines are not available on this target. ISO C does not allow an
+ * empty translation unit.
+ */
+typedef int present_simd_unused_t;
+
+#endif  /* CPU_USE_X86 */
+
+/*** END OF FILE ***/
@@ -0,0 +1,283 @@
+/**
+ * @file present_stream.c
+ * @brief Source file of the PRESENT streaming interface.
+ *
+ * The file is the C implementation of the PRESENT streaming interface. The
+ * file contains global and static function definitions, data structures,
+ * type definitions, etc, of the module.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_stream.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_STREAM)
+
+#if CONF_PRESENT_STREAM
+
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <string.h>
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <present_cbc.h>
+#include <assert.h>
+
+/*****************************************************************************/
+/* COMPILE-TIME ERROR CHECKS                                                 */
+/*****************************************************************************/
+
+#if !CONF_PRESENT_CBC
+#   error "Streaming interface requires the CBC mode module!"
+#endif
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Processes consecutive blocks in the mode of the stream.
+ *
+ * The function processes \p count blocks of \p p_src and writes them to
+ * \p p_dst.
+ *
+ * @param[in,out] p_stream Pointer of the stream state.
+ * @param[out]    p_dst    Pointer of the output buffer.
+ * @param[in]     p_src    Pointer of the input buffer.
+ * @param[in]     count    Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_stream_blocks(present_stream_t * p_stream, uint8_t * p_dst, \
+                      uint8_t const * p_src, size_t count);
+
+/*****************************************************************************/
+/* GLOBAL FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+void
+present_stream_init (present_stream_t * p_stream, \
+                     present_ctx_t const * p_ctx, \
+                     present_stream_mode_t mode, bool encrypt, bool padding, \
+                     uint8_t const * p_iv)
+{
+    ASSERT(NULL != p_stream);
+    ASSERT(NULL != p_ctx);
+    ASSERT((NULL != p_iv) || (PRESENT_STREAM_CBC != mode));
+
+    p_stream->p_ctx    = p_ctx;
+    p_stream->mode     = mode;
+    p_stream->encrypt  = encrypt;
+    p_stream->padding  = padding;
+    p_stream->buffered = 0u;
+
+    if (PRESENT_STREAM_CBC == mode)
+    {
+        memcpy(p_stream->chain, p_iv, PRESENT_CRYPT_SIZE);
+    }
+}  /* present_stream_init() */
+
+size_t
+present_stream_update (present_stream_t * p_stream, uint8_t * p_dst, \
+                       uint8_t const * p_src, size_t size)
+{
+    size_t written = 0u;
+    size_t count;
+    size_t part;
+    bool   hold;
+
+    ASSERT(NULL != p_stream);
+    ASSERT((NULL != p_dst) || (0u == size));
+    ASSERT((NULL != p_src) || (0u == size));
+
+    if (0u == size)
+    {
+        return 0u;
+    }
+
+    /*
+     * The last block of a padded message must reach the final call, since
+     * only then it is known to be the last one.
+     */
+    hold = p_stream->padding && !p_stream->encrypt;
+
+    if (p_stream->buffered > 0u)
+    {
+        part = PRESENT_CRYPT_SIZE - p_stream->buffered;
+        part = (part < size) ? part : size;
+
+        memcpy(&p_stream->buffer[p_stream->buffered], p_src, part);
+
+        p_stream->buffered = (uint8_t)(p_stream->buffered + part);
+        p_src += part;
+        size  -= part;
+
+        if ((p_stream->buffered < PRESENT_CRYPT_SIZE)
+            || (hold && (0u == size)))
+        {
+            return 0u;
+        }
+
+        present_stream_blocks(p_stream, p_dst, p_stream->buffer, 1u);
+
+        p_stream->buffered = 0u;
+        p_dst  += PRESENT_CRYPT_SIZE;
+        written = PRESENT_CRYPT_SIZE;
+    }
+
+    /*
+     * Process the full blocks from the input buffer directly.
+     */
+    count = size / PRESENT_CRYPT_SIZE;
+    part  = size % PRESENT_CRYPT_SIZE;
+
+    if (hold && (count > 0u) && (0u == part))
+    {
+        count--;
+        part = PRESENT_CRYPT_SIZE;
+    }
+
+    if (count > 0u)
+    {
+        present_stream_blocks(p_stream, p_dst, p_src, count);
+    }
+
+    memcpy(p_stream->buffer, &p_src[count * PRESENT_CRYPT_SIZE], part);
+    p_stream->buffered = (uint8_t)part;
+
+    return written + count * PRESENT_CRYPT_SIZE;
+}  /* present_stream_update() */
+
+bool
+present_stream_final (present_stream_t * p_stream, uint8_t * p_dst, \
+                      size_t * p_size)
+{
+    uint8_t block[PRESENT_CRYPT_SIZE];
+    uint8_t invalid = 0u;
+    uint8_t pad;
+    uint8_t byte;
+
+    ASSERT(NULL != p_stream);
+    ASSERT(NULL != p_dst);
+    ASSERT(NULL != p_size);
+
+    *p_size = 0u;
+
+    if (!p_stream->padding)
+    {
+        return 0u == p_stream->buffered;
+    }
+
+    if (p_stream->encrypt)
+    {
+        pad = (uint8_t)(PRESENT_CRYPT_SIZE - p_stream->buffered);
+
+        memset(&p_stream->buffer[p_stream->buffered], pad, pad);
+        present_stream_blocks(p_stream, p_dst, p_stream->buffer, 1u);
+
+        p_stream->buffered = 0u;
+        *p_size = PRESENT_CRYPT_SIZE;
+
+        return true;
+    }
+
+    if (PRESENT_CRYPT_SIZE != p_stream->buffered)
+    {
+        return false;
+    }
+
+    present_stream_blocks(p_stream, block, p_stream->buffer, 1u);
+    p_stream->buffered = 0u;
+
+    /*
+     * Check all the bytes regardless of the pad value, so that the check
+     * time does not tell where the padding is wrong.
+     */
+    pad      = block[PRESENT_CRYPT_SIZE - 1u];
+    invalid |= (uint8_t)((0u == pad) | (pad > PRESENT_CRYPT_SIZE));
+
+    for (byte = 0u; byte < PRESENT_CRYPT_SIZE; byte++)
+    {
+        if (PRESENT_CRYPT_SIZE - byte <= pad)
+        {
+            invalid |= block[byte] ^ pad;
+        }
+    }
+
+    if (invalid)
+    {
+        return false;
+    }
+
+    memcpy(p_dst, block, PRESENT_CRYPT_SIZE - pad);
+    *p_size = PRESENT_CRYPT_SIZE - pad;
+
+    return true;
+}  /* present_stream_final() */
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static void
+present_stream_blocks (present_stream_t * p_stream, uint8_t * p_dst, \
+                       uint8_t const * p_src, size_t count)
+{
+    if (PRESENT_STREAM_CBC == p_stream->mode)
+    {
+        if (p_stream->encrypt)
+        {
+            present_cbc_encrypt(p_stream->p_ctx, p_stream->chain, p_dst, \
+                                p_src, count);
+        }
+        else
+        {
+            present_cbc_decrypt(p_stream->p_ctx, p_stream->chain, p_dst, \
+                                p_src, count);
+        }
+    }
+    else if (p_stream->encrypt)
+    {
+        present_encrypt_blocks(p_stream->p_ctx, p_dst, p_src, count);
+    }
+    else
+    {
+        present_decrypt_blocks(p_stream->p_ctx, p_dst, p_src, count);
+    }
+}  /* present_stream_blocks() */
+
+#else
+
+/*
+ * ISO C forbids an empty translation unit.
+ */
+typedef int present_stream_unused_t;
+
+#endif  /* CONF_PRESENT_STREAM */
+
+/*** END OF FILE ***/
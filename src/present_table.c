@@ -0,0 +1,366 @@
+/**
+ * @file present_table.c
+ * @brief Source file of the PRESENT table engine.
+ *
+ * The file is the C implementation of the PRESENT crypt engine that merges
+ * the substitution and the permutation layers into lookup tables. The file
+ * contains global and static function definitions, data structures, type
+ * definitions, etc, of the engine.
+ *
+ * Every byte of the text block is substituted independently, and the
+ * permutation moves every bit to a fixed position. Therefore, both layers
+ * could be precomputed for every value of every byte. A round is eight
+ * lookups ORed together plus the add key layer.
+ *
+ * The tables are constant expressions that are evaluated by the compiler,
+ * so they are generated at build time and placed in the read-only memory.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @see <a href=
+ *      "https://link.springer.com/chapter/10.1007%2F978-3-540-74735-2_31">
+ *      PRESENT: An Ultra-Lightweight Block Cipher</a>
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_engine.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_TABLE)
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <assert.h>
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * The lookup table @ref g_sbox packed into a word. The nibble n of the word
+ * is the substitution of the value n.
+ */
+#define PRESENT_SBOX_PACKED     (UINT64_C(0x21748FE3DA09B65C))
+
+/*
+ * The lookup table @ref g_sbox_inv packed into a word. The nibble n of the
+ * word is the inverse substitution of the value n.
+ */
+#define PRESENT_SBOX_INV_PACKED (UINT64_C(0xA970364BD21C8FE5))
+
+/*
+ * Count of the values of a byte.
+ */
+#define PRESENT_TABLE_SIZE (256u)
+
+/*****************************************************************************/
+/* STATIC MACRO FUNCTIONS                                                    */
+/*****************************************************************************/
+
+/*
+ * Substitutes both nibbles of the byte \a b with the packed table \a sbox.
+ */
+#define PRESENT_SBOX_BYTE(sbox, b)                                           \
+    ((((sbox) >> (4u * ((b) & 0x0Fu))) & 0x0Fu)                              \
+     | ((((sbox) >> (4u * ((b) >> 4))) & 0x0Fu) << 4))
+
+/*
+ * New position of the bit k after the permutation layer.
+ */
+#define PRESENT_PERM_POS(k)     (16u * ((k) % 4u) + ((k) / 4u))
+
+/*
+ * New position of the bit k after the inverse permutation layer.
+ */
+#define PRESENT_PERM_INV_POS(k) (4u * ((k) % 16u) + ((k) / 16u))
+
+/*
+ * Moves the bit j of the byte \a v, which is the byte i of the text block,
+ * to the position given by \a pos.
+ */
+#define PRESENT_MOVE_BIT(pos, v, i, j)                                       \
+    ((((uint64_t)(v) >> (j)) & 1u) << pos(8u * (i) + (j)))
+
+/*
+ * Moves all the bits of the byte \a v, which is the byte i of the text
+ * block, to the positions given by \a pos.
+ */
+#define PRESENT_MOVE_BYTE(pos, v, i)                                         \
+    (PRESENT_MOVE_BIT(pos, v, i, 0u) | PRESENT_MOVE_BIT(pos, v, i, 1u)       \
+     | PRESENT_MOVE_BIT(pos, v, i, 2u) | PRESENT_MOVE_BIT(pos, v, i, 3u)     \
+     | PRESENT_MOVE_BIT(pos, v, i, 4u) | PRESENT_MOVE_BIT(pos, v, i, 5u)     \
+     | PRESENT_MOVE_BIT(pos, v, i, 6u) | PRESENT_MOVE_BIT(pos, v, i, 7u))
+
+/*
+ * Entry of the encryption table. Byte i of the text block is substituted
+ * and then permutated.
+ */
+#define PRESENT_ENC_ENTRY(i, b)                                              \
+    PRESENT_MOVE_BYTE(PRESENT_PERM_POS,                                      \
+                      PRESENT_SBOX_BYTE(PRESENT_SBOX_PACKED, b), i)
+
+/*
+ * Entry of the decryption table. Byte i of the text block is inverse
+ * substituted and then inverse permutated.
+ */
+#define PRESENT_DEC_ENTRY(i, b)                                              \
+    PRESENT_MOVE_BYTE(PRESENT_PERM_INV_POS,                                  \
+                      PRESENT_SBOX_BYTE(PRESENT_SBOX_INV_PACKED, b), i)
+
+/*
+ * Expands the table entries of the byte i from the value b.
+ */
+#define PRESENT_ROW_4(f, i, b)                                               \
+    f(i, (b)), f(i, (b) + 1u), f(i, (b) + 2u), f(i, (b) + 3u)
+
+#define PRESENT_ROW_16(f, i, b)                                              \
+    PRESENT_ROW_4(f, i, (b)), PRESENT_ROW_4(f, i, (b) + 4u),                 \
+    PRESENT_ROW_4(f, i, (b) + 8u), PRESENT_ROW_4(f, i, (b) + 12u)
+
+#define PRESENT_ROW_64(f, i, b)                                              \
+    PRESENT_ROW_16(f, i, (b)), PRESENT_ROW_16(f, i, (b) + 16u),              \
+    PRESENT_ROW_16(f, i, (b) + 32u), PRESENT_ROW_16(f, i, (b) + 48u)
+
+#define PRESENT_ROW(f, i)                                                    \
+    {                                                                        \
+        PRESENT_ROW_64(f, i, 0u), PRESENT_ROW_64(f, i, 64u),                 \
+        PRESENT_ROW_64(f, i, 128u), PRESENT_ROW_64(f, i, 192u)               \
+    }
+
+/*
+ * Expands all the rows of a table.
+ */
+#define PRESENT_TABLE(f)                                                     \
+    {                                                                        \
+        PRESENT_ROW(f, 0u), PRESENT_ROW(f, 1u), PRESENT_ROW(f, 2u),          \
+        PRESENT_ROW(f, 3u), PRESENT_ROW(f, 4u), PRESENT_ROW(f, 5u),          \
+        PRESENT_ROW(f, 6u), PRESENT_ROW(f, 7u)                               \
+    }
+
+/*
+ * Looks up all the bytes of \a state in the table \a t and merges them.
+ */
+#define PRESENT_TABLE_ROUND(t, state)                                        \
+    ((t)[0][((state) >>  0) & 0xFFu] | (t)[1][((state) >>  8) & 0xFFu]      \
+     | (t)[2][((state) >> 16) & 0xFFu] | (t)[3][((state) >> 24) & 0xFFu]    \
+     | (t)[4][((state) >> 32) & 0xFFu] | (t)[5][((state) >> 40) & 0xFFu]    \
+     | (t)[6][((state) >> 48) & 0xFFu] | (t)[7][((state) >> 56) & 0xFFu])
+
+/*****************************************************************************/
+/* GLOBAL VARIABLES                                                          */
+/*****************************************************************************/
+
+/**
+ * Merged substitution and permutation table of the encryption.
+ */
+static uint64_t const g_table_enc[PRESENT_CRYPT_SIZE][PRESENT_TABLE_SIZE] = \
+    PRESENT_TABLE(PRESENT_ENC_ENTRY);
+
+/**
+ * Merged inverse substitution and inverse permutation table of the
+ * decryption.
+ */
+static uint64_t const g_table_dec[PRESENT_CRYPT_SIZE][PRESENT_TABLE_SIZE] = \
+    PRESENT_TABLE(PRESENT_DEC_ENTRY);
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Encryption kernel of the table engine.
+ *
+ * The function encrypts \p count blocks of \p p_src with \p rounds rounds
+ * and writes them to \p p_dst.
+ *
+ * @param[in]  p_ctx  Pointer of the crypt context.
+ * @param[out] p_dst  Pointer of the crypted text buffer.
+ * @param[in]  p_src  Pointer of the raw text buffer.
+ * @param[in]  count  Count of the blocks.
+ * @param[in]  rounds Count of the rounds.
+ *
+ * @return None.
+ */
+static PRESENT_INLINE void
+present_table_encrypt_kernel(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count, \
+                             uint8_t rounds);
+
+/**
+ * @brief Decryption kernel of the table engine.
+ *
+ * The function decrypts \p count blocks of \p p_src with \p rounds rounds
+ * and writes them to \p p_dst.
+ *
+ * @param[in]  p_ctx  Pointer of the crypt context.
+ * @param[out] p_dst  Pointer of the raw text buffer.
+ * @param[in]  p_src  Pointer of the crypted text buffer.
+ * @param[in]  count  Count of the blocks.
+ * @param[in]  rounds Count of the rounds.
+ *
+ * @return None.
+ */
+static PRESENT_INLINE void
+present_table_decrypt_kernel(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count, \
+                             uint8_t rounds);
+
+/**
+ * @brief Encrypts consecutive text blocks with the table engine.
+ *
+ * The function is the multi-block encryption function of the table engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the crypted text buffer.
+ * @param[in]  p_src Pointer of the raw text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_table_encrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with the table engine.
+ *
+ * The function is the multi-block decryption function of the table engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the raw text buffer.
+ * @param[in]  p_src Pointer of the crypted text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_table_decrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count);
+
+/*****************************************************************************/
+/* ENGINE DEFINITIONS                                                        */
+/*****************************************************************************/
+
+present_engine_t const g_present_engine_table = {
+    "table",
+    0u,
+    present_table_encrypt_blocks,
+    present_table_decrypt_blocks,
+    NULL,
+    NULL,
+    NULL
+};
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static PRESENT_INLINE void
+present_table_encrypt_kernel (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                              uint8_t const * p_src, size_t count, \
+                              uint8_t rounds)
+{
+    uint64_t state;
+    uint8_t  round;
+
+    while (count > 0u)
+    {
+        state = present_load64(p_src);
+
+        for (round = 0u; round < rounds; round++)
+        {
+            state ^= p_ctx->round_key[round];
+            state  = PRESENT_TABLE_ROUND(g_table_enc, state);
+        }
+
+        state ^= p_ctx->round_key[rounds];
+
+        present_store64(p_dst, state);
+
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+        count--;
+    }
+}  /* present_table_encrypt_kernel() */
+
+static PRESENT_INLINE void
+present_table_decrypt_kernel (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                              uint8_t const * p_src, size_t count, \
+                              uint8_t rounds)
+{
+    uint64_t state;
+    uint8_t  round;
+
+    while (count > 0u)
+    {
+        /*
+         * The decryption round is the inverse permutation followed by the
+         * inverse substitution. To merge both layers into the table, the
+         * round is shifted by a permutation: the key addition is moved
+         * after the inverse permutation, and the round keys are moved by
+         * the inverse permutation layer as well.
+         */
+        state  = present_permute64_inv(present_load64(p_src));
+        state ^= p_ctx->inv_round_key[rounds];
+
+        for (round = rounds - 1u; round > 0u; round--)
+        {
+            state  = PRESENT_TABLE_ROUND(g_table_dec, state);
+            state ^= p_ctx->inv_round_key[round];
+        }
+
+        /*
+         * The last round has only the inverse substitution. Undo the
+         * inverse permutation of the table lookup.
+         */
+        state  = present_permute64(PRESENT_TABLE_ROUND(g_table_dec, state));
+        state ^= p_ctx->round_key[0];
+
+        present_store64(p_dst, state);
+
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+        count--;
+    }
+}  /* present_table_decrypt_kernel() */
+
+static void
+present_table_encrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                              uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_ctx);
+
+    PRESENT_ROUND_DISPATCH(present_table_encrypt_kernel, p_ctx, p_dst, \
+                           p_src, count);
+}  /* present_table_encrypt_blocks() */
+
+static void
+present_table_decrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                              uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_ctx);
+
+    PRESENT_ROUND_DISPATCH(present_table_decrypt_kernel, p_ctx, p_dst, \
+                           p_src, count);
+}  /* present_table_decrypt_blocks() */
+
+/*** END OF FILE ***/
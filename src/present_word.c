@@ -0,0 +1,267 @@
+/**
+ * @file present_word.c
+ * @brief Source file of the PRESENT 64-bit word engine.
+ *
+ * The file is the C implementation of the PRESENT crypt engine that keeps
+ * the text block in a single 64-bit word during all rounds. The file
+ * contains global and static function definitions, data structures, type
+ * definitions, etc, of the engine.
+ *
+ * The text block is loaded into a word once per block. The add key layer is
+ * a single XOR operation, the substitution layer works on the nibbles of the
+ * word and the permutation layer is composed of four delta swaps.
+ *
+ * All functions, type definitions, data structures, etc., that used in
+ * header or source files were documented in the file which it is declared.
+ * For further information, see its detailed documentation.
+ *
+ * @see <a href=
+ *      "https://link.springer.com/chapter/10.1007%2F978-3-540-74735-2_31">
+ *      PRESENT: An Ultra-Lightweight Block Cipher</a>
+ *
+ * @author Furkan Kurt - kurtfu[at]yahoo.com
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026 Furkan Kurt
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ */
+#include <present_engine.h>
+
+/**
+ * ID number of the module.
+ */
+#define ID__ (FILE_ID_PRESENT_WORD)
+
+/*****************************************************************************/
+/* PROJECT LIBRARIES                                                         */
+/*****************************************************************************/
+
+#include <assert.h>
+
+/*****************************************************************************/
+/* STATIC SYMBOL DEFINITIONS                                                 */
+/*****************************************************************************/
+
+/*
+ * Mask of a nibble in the text block.
+ */
+#define PRESENT_NIBBLE_MASK (0x0Fu)
+
+/*****************************************************************************/
+/* STATIC FUNCTION PROTOTYPES                                                */
+/*****************************************************************************/
+
+/**
+ * @brief Substitution layer of the algorithm on a 64-bit word.
+ *
+ * The function replaces all the nibbles of \p state with values from
+ * \p p_sbox. For further information about the PRESENT substitution layer,
+ * see article's section 3.
+ *
+ * @param[in] state  The text block.
+ * @param[in] p_sbox Pointer of the substitution lookup table.
+ *
+ * @return The substituted text block.
+ */
+static uint64_t
+present_word_substitution(uint64_t state, uint8_t const * p_sbox);
+
+/**
+ * @brief Encryption kernel of the word engine.
+ *
+ * The function encrypts \p count blocks of \p p_src with \p rounds rounds
+ * and writes them to \p p_dst.
+ *
+ * @param[in]  p_ctx  Pointer of the crypt context.
+ * @param[out] p_dst  Pointer of the crypted text buffer.
+ * @param[in]  p_src  Pointer of the raw text buffer.
+ * @param[in]  count  Count of the blocks.
+ * @param[in]  rounds Count of the rounds.
+ *
+ * @return None.
+ */
+static PRESENT_INLINE void
+present_word_encrypt_kernel(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count, \
+                            uint8_t rounds);
+
+/**
+ * @brief Decryption kernel of the word engine.
+ *
+ * The function decrypts \p count blocks of \p p_src with \p rounds rounds
+ * and writes them to \p p_dst.
+ *
+ * @param[in]  p_ctx  Pointer of the crypt context.
+ * @param[out] p_dst  Pointer of the raw text buffer.
+ * @param[in]  p_src  Pointer of the crypted text buffer.
+ * @param[in]  count  Count of the blocks.
+ * @param[in]  rounds Count of the rounds.
+ *
+ * @return None.
+ */
+static PRESENT_INLINE void
+present_word_decrypt_kernel(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count, \
+                            uint8_t rounds);
+
+/**
+ * @brief Encrypts consecutive text blocks with the word engine.
+ *
+ * The function is the multi-block encryption function of the word engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the crypted text buffer.
+ * @param[in]  p_src Pointer of the raw text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_word_encrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count);
+
+/**
+ * @brief Decrypts consecutive text blocks with the word engine.
+ *
+ * The function is the multi-block decryption function of the word engine.
+ *
+ * @param[in]  p_ctx Pointer of the crypt context.
+ * @param[out] p_dst Pointer of the raw text buffer.
+ * @param[in]  p_src Pointer of the crypted text buffer.
+ * @param[in]  count Count of the blocks.
+ *
+ * @return None.
+ */
+static void
+present_word_decrypt_blocks(present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                            uint8_t const * p_src, size_t count);
+
+/*****************************************************************************/
+/* ENGINE DEFINITIONS                                                        */
+/*****************************************************************************/
+
+present_engine_t const g_present_engine_word = {
+    "word",
+    0u,
+    present_word_encrypt_blocks,
+    present_word_decrypt_blocks,
+    NULL,
+    NULL,
+    NULL
+};
+
+/*****************************************************************************/
+/* STATIC FUNCTION DEFINITIONS                                               */
+/*****************************************************************************/
+
+static uint64_t
+present_word_substitution (uint64_t state, uint8_t const * p_sbox)
+{
+    uint64_t result = 0u;
+    uint8_t  shift;
+
+    /*
+     * Replace all the nibbles of the word from the least significant one.
+     */
+    for (shift = 0u; shift < PRESENT_CRYPT_BIT_SIZE; shift += 4u)
+    {
+        result |= (uint64_t)p_sbox[(state >> shift) & PRESENT_NIBBLE_MASK] \
+                  << shift;
+    }
+
+    return result;
+}  /* present_word_substitution() */
+
+static PRESENT_INLINE void
+present_word_encrypt_kernel (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count, \
+                             uint8_t rounds)
+{
+    uint64_t state;
+    uint8_t  round;
+
+    while (count > 0u)
+    {
+        /*
+         * Load the block once and keep it in the word during all rounds.
+         */
+        state = present_load64(p_src);
+
+        for (round = 0u; round < rounds; round++)
+        {
+            state ^= p_ctx->round_key[round];
+            state  = present_word_substitution(state, g_sbox);
+            state  = present_permute64(state);
+        }
+
+        state ^= p_ctx->round_key[rounds];
+
+        present_store64(p_dst, state);
+
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+        count--;
+    }
+}  /* present_word_encrypt_kernel() */
+
+static PRESENT_INLINE void
+present_word_decrypt_kernel (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count, \
+                             uint8_t rounds)
+{
+    uint64_t state;
+    uint8_t  round;
+
+    while (count > 0u)
+    {
+        /*
+         * Load the block once and keep it in the word during all rounds.
+         */
+        state  = present_load64(p_src);
+        state ^= p_ctx->round_key[rounds];
+
+        for (round = rounds; round > 0u; round--)
+        {
+            state  = present_permute64_inv(state);
+            state  = present_word_substitution(state, g_sbox_inv);
+            state ^= p_ctx->round_key[round - 1u];
+        }
+
+        present_store64(p_dst, state);
+
+        p_dst += PRESENT_CRYPT_SIZE;
+        p_src += PRESENT_CRYPT_SIZE;
+        count--;
+    }
+}  /* present_word_decrypt_kernel() */
+
+static void
+present_word_encrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_ctx);
+
+    PRESENT_ROUND_DISPATCH(present_word_encrypt_kernel, p_ctx, p_dst, p_src, \
+                           count);
+}  /* present_word_encrypt_blocks() */
+
+static void
+present_word_decrypt_blocks (present_ctx_t const * p_ctx, uint8_t * p_dst, \
+                             uint8_t const * p_src, size_t count)
+{
+    ASSERT(NULL != p_ctx);
+
+    PRESENT_ROUND_DISPATCH(present_word_decrypt_kernel, p_ctx, p_dst, p_src, \
+                           count);
+}  /* present_word_decrypt_blocks() */
+
+/*** END OF FILE ***/
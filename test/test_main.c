@@ -28,11 +28,29 @@
  * in all copies or substantial portions of the Software.
  */
 
+/*****************************************************************************/
+/* STANDART C LIBRARIES                                                      */
+/*****************************************************************************/
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
 /*****************************************************************************/
 /* PROJECT LIBRARIES                                                         */
 /*****************************************************************************/
 
 #include <present.h>
+#include <present_async.h>
+#include <present_cache.h>
+#include <present_cbc.h>
+#include <present_ctr.h>
+#include <present_iov.h>
+#include <present_mb.h>
+#include <present_numa.h>
+#include <present_pool.h>
+#include <present_sched.h>
+#include <present_stream.h>
 #include <unity.h>
 
 /*****************************************************************************/
@@ -145,6 +163,1634 @@ void test_decrypt(void)
     TEST_ASSERT_EQUAL_HEX8_ARRAY(cipher_4, decipher_4, sizeof(decipher_4));
 }  /* test_decrypt() */
 
+/**
+ * @brief Test function of the expanded key context.
+ *
+ * The function expands each key once and uses the same context to encrypt
+ * and decrypt the text blocks given in the article's appendix I.
+ *
+ * @return None.
+ */
+void test_ctx_crypt(void)
+{
+    present_ctx_t ctx;
+
+    uint8_t block_1[] = {0x00u, 0x00u, 0x00u, 0x00u, \
+                         0x00u, 0x00u, 0x00u, 0x00u};
+
+    uint8_t block_2[] = {0xFFu, 0xFFu, 0xFFu, 0xFFu, \
+                         0xFFu, 0xFFu, 0xFFu, 0xFFu};
+
+    uint8_t const expected_1[] = {0x49u, 0x50u, 0x94u, 0xF5u, \
+                                  0xC0u, 0x46u, 0x2Cu, 0xE7u};
+
+    uint8_t const expected_2[] = {0x7Bu, 0x41u, 0x68u, 0x2Fu, \
+                                  0xC7u, 0xFFu, 0x12u, 0xA1u};
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_2, PRESENT_KEY80_SIZE));
+
+    present_ctx_encrypt(&ctx, block_1);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_1, block_1, sizeof(block_1));
+
+    present_ctx_decrypt(&ctx, block_1);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(decipher_2, block_1, sizeof(block_1));
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_3, PRESENT_KEY80_SIZE));
+
+    present_ctx_encrypt(&ctx, block_2);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_2, block_2, sizeof(block_2));
+
+    present_ctx_decrypt(&ctx, block_2);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(decipher_3, block_2, sizeof(block_2));
+}  /* test_ctx_crypt() */
+
+/**
+ * @brief Test function of the key sizes.
+ *
+ * The function expands 80-bit and 128-bit keys in the same build and
+ * checks the results with the test vectors of both key sizes.
+ *
+ * @return None.
+ */
+void test_key_sizes(void)
+{
+    present_ctx_t ctx_80;
+    present_ctx_t ctx_128;
+    uint8_t       key[PRESENT_KEY128_SIZE];
+    uint8_t       block_1[PRESENT_CRYPT_SIZE];
+    uint8_t       block_2[PRESENT_CRYPT_SIZE];
+
+    uint8_t const expected_80[] = {0x45u, 0x84u, 0x22u, 0x7Bu, \
+                                   0x38u, 0xC1u, 0x79u, 0x55u};
+
+    uint8_t const expected_128[] = {0xAFu, 0x00u, 0x69u, 0x2Eu, \
+                                    0x2Au, 0x70u, 0xDBu, 0x96u};
+
+    memset(key, 0x00, sizeof(key));
+    memset(block_1, 0x00, sizeof(block_1));
+    memset(block_2, 0x00, sizeof(block_2));
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx_80, key, PRESENT_KEY80_SIZE));
+    TEST_ASSERT_TRUE(present_key_setup(&ctx_128, key, PRESENT_KEY128_SIZE));
+    TEST_ASSERT_FALSE(present_key_setup(&ctx_128, key, 12u));
+
+    present_ctx_encrypt(&ctx_80, block_1);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_80, block_1, sizeof(block_1));
+
+    present_ctx_encrypt(&ctx_128, block_2);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_128, block_2, sizeof(block_2));
+
+    present_ctx_decrypt(&ctx_128, block_2);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0x00u, block_2, sizeof(block_2));
+}  /* test_key_sizes() */
+
+/**
+ * @brief Test function of the multi-block crypt operations.
+ *
+ * The function encrypts a buffer of blocks both out of place and in place,
+ * compares the result with the single block encryption and decrypts the
+ * buffer back.
+ *
+ * @return None.
+ */
+void test_blocks_crypt(void)
+{
+    present_ctx_t ctx;
+    uint8_t       plain[4u * PRESENT_CRYPT_SIZE];
+    uint8_t       crypt[4u * PRESENT_CRYPT_SIZE];
+    uint8_t       check[4u * PRESENT_CRYPT_SIZE];
+    size_t        byte;
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 37u);
+        check[byte] = plain[byte];
+    }
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_4, PRESENT_KEY80_SIZE));
+
+    for (byte = 0u; byte < sizeof(check); byte += PRESENT_CRYPT_SIZE)
+    {
+        present_ctx_encrypt(&ctx, &check[byte]);
+    }
+
+    present_encrypt_blocks(&ctx, crypt, plain, 4u);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(crypt));
+
+    present_decrypt_blocks(&ctx, crypt, crypt, 4u);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plain, crypt, sizeof(crypt));
+
+    present_encrypt_blocks(&ctx, plain, plain, 4u);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, plain, sizeof(plain));
+}  /* test_blocks_crypt() */
+
+/**
+ * @brief Test function of the crypt engines.
+ *
+ * The function encrypts the same buffer with every engine, compares the
+ * result with the reference engine and decrypts the buffer back. The buffer
+ * is longer than a batch of the bitsliced engine.
+ *
+ * @return None.
+ */
+void test_engines(void)
+{
+    present_ctx_t       ctx;
+    present_engine_id_t engine;
+    uint8_t             plain[80u * PRESENT_CRYPT_SIZE];
+    uint8_t             check[80u * PRESENT_CRYPT_SIZE];
+    uint8_t             crypt[80u * PRESENT_CRYPT_SIZE];
+    uint8_t             key[PRESENT_KEY_SIZE];
+    size_t              byte;
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 101u + 7u);
+    }
+
+    for (byte = 0u; byte < sizeof(key); byte++)
+    {
+        key[byte] = (uint8_t)(byte * 59u + 3u);
+    }
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key, sizeof(key)));
+
+    TEST_ASSERT_TRUE(present_set_engine(PRESENT_ENGINE_REF));
+    present_encrypt_blocks(&ctx, check, plain, 80u);
+
+    for (engine = PRESENT_ENGINE_REF; engine < PRESENT_ENGINE_COUNT; engine++)
+    {
+        /*
+         * Skip the engines that are not supported by the host CPU.
+         */
+        if (!present_set_engine(engine))
+        {
+            continue;
+        }
+
+        present_encrypt_blocks(&ctx, crypt, plain, 80u);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(crypt));
+
+        present_decrypt_blocks(&ctx, crypt, crypt, 80u);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(plain, crypt, sizeof(crypt));
+    }
+
+    TEST_ASSERT_FALSE(present_set_engine(PRESENT_ENGINE_COUNT));
+
+    TEST_ASSERT_TRUE(present_set_engine(PRESENT_ENGINE_WORD));
+    TEST_ASSERT_EQUAL(PRESENT_ENGINE_WORD, present_get_engine());
+    TEST_ASSERT_EQUAL_STRING("word", \
+                             present_get_engine_name(present_get_engine()));
+
+    /*
+     * Without an override, the automatic selection never picks the slower
+     * portable engines.
+     */
+    present_reset_engine();
+    TEST_ASSERT_NOT_NULL(present_get_engine_name(present_get_engine()));
+
+    if (NULL == getenv(PRESENT_ENGINE_ENV))
+    {
+        TEST_ASSERT_TRUE(present_get_engine() > PRESENT_ENGINE_WORD);
+    }
+}  /* test_engines() */
+
+/**
+ * @brief Test function of the round counts.
+ *
+ * The function sweeps all the round counts and checks that every engine
+ * gives the result of the reference engine and decrypts it back.
+ *
+ * @return None.
+ */
+void test_round_counts(void)
+{
+    present_ctx_t       ctx;
+    present_engine_id_t engine;
+    uint8_t             plain[80u * PRESENT_CRYPT_SIZE];
+    uint8_t             check[80u * PRESENT_CRYPT_SIZE];
+    uint8_t             crypt[80u * PRESENT_CRYPT_SIZE];
+    uint8_t             key[PRESENT_KEY128_SIZE];
+    uint8_t             rounds;
+    size_t              byte;
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 29u + 11u);
+    }
+
+    for (byte = 0u; byte < sizeof(key); byte++)
+    {
+        key[byte] = (uint8_t)(byte * 83u + 5u);
+    }
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key, sizeof(key)));
+    TEST_ASSERT_EQUAL_UINT8(PRESENT_ROUND_COUNT, ctx.rounds);
+
+    TEST_ASSERT_FALSE(present_set_round_count(&ctx, 0u));
+    TEST_ASSERT_FALSE(present_set_round_count(&ctx, 32u));
+
+    for (rounds = PRESENT_ROUND_COUNT_MIN; rounds <= PRESENT_ROUND_COUNT_MAX;
+         rounds++)
+    {
+        TEST_ASSERT_TRUE(present_set_round_count(&ctx, rounds));
+
+        TEST_ASSERT_TRUE(present_set_engine(PRESENT_ENGINE_REF));
+        present_encrypt_blocks(&ctx, check, plain, 80u);
+
+        for (engine = PRESENT_ENGINE_WORD; engine < PRESENT_ENGINE_COUNT;
+             engine++)
+        {
+            if (!present_set_engine(engine))
+            {
+                continue;
+            }
+
+            present_encrypt_blocks(&ctx, crypt, plain, 80u);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(crypt));
+
+            present_decrypt_blocks(&ctx, crypt, crypt, 80u);
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(plain, crypt, sizeof(crypt));
+        }
+    }
+
+    present_reset_engine();
+}  /* test_round_counts() */
+
+/**
+ * @brief Test function of the key cache.
+ *
+ * The function checks that the cached contexts are identical to the
+ * expanded ones, and that a full set evicts a key and counts the misses.
+ *
+ * @return None.
+ */
+void test_cache(void)
+{
+    present_cache_slot_t slots[PRESENT_CACHE_WAYS];
+    present_cache_t      cache;
+    present_ctx_t        check;
+    present_ctx_t        ctx;
+    uint8_t              key[PRESENT_KEY128_SIZE];
+    unsigned long        hits;
+    unsigned long        misses;
+    uint8_t              way;
+
+    present_cache_init(&cache, slots, PRESENT_CACHE_WAYS);
+
+    TEST_ASSERT_FALSE(present_cache_get(&cache, key, 12u, &ctx));
+
+    /*
+     * Fill the only set of the cache, then hit all of its keys.
+     */
+    memset(key, 0x5Au, sizeof(key));
+
+    for (way = 0u; way <= PRESENT_CACHE_WAYS; way++)
+    {
+        key[0] = way;
+        TEST_ASSERT_TRUE(present_cache_get(&cache, key, sizeof(key), &ctx));
+
+        TEST_ASSERT_TRUE(present_key_setup(&check, key, sizeof(key)));
+        TEST_ASSERT_EQUAL_HEX64_ARRAY(check.round_key, ctx.round_key, \
+                                      PRESENT_ROUND_COUNT_MAX + 1u);
+
+        if (PRESENT_CACHE_WAYS == way)
+        {
+            break;
+        }
+
+        TEST_ASSERT_TRUE(present_cache_get(&cache, key, sizeof(key), &ctx));
+        TEST_ASSERT_EQUAL_HEX64_ARRAY(check.round_key, ctx.round_key, \
+                                      PRESENT_ROUND_COUNT_MAX + 1u);
+    }
+
+    present_cache_stats(&cache, &hits, &misses);
+    TEST_ASSERT_EQUAL_UINT32(PRESENT_CACHE_WAYS, hits);
+    TEST_ASSERT_EQUAL_UINT32(PRESENT_CACHE_WAYS + 1u, misses);
+
+    /*
+     * The last key evicted one of the first keys, so the first keys could
+     * not all be hits.
+     */
+    for (way = 0u; way < PRESENT_CACHE_WAYS; way++)
+    {
+        key[0] = way;
+        TEST_ASSERT_TRUE(present_cache_get(&cache, key, sizeof(key), &ctx));
+    }
+
+    present_cache_stats(&cache, &hits, &misses);
+    TEST_ASSERT_TRUE(misses > PRESENT_CACHE_WAYS + 1u);
+
+    /*
+     * The same bytes with another key size are another key.
+     */
+    TEST_ASSERT_TRUE(present_cache_get(&cache, key, PRESENT_KEY80_SIZE, \
+                                       &ctx));
+    TEST_ASSERT_TRUE(present_key_setup(&check, key, PRESENT_KEY80_SIZE));
+    TEST_ASSERT_EQUAL_HEX64_ARRAY(check.round_key, ctx.round_key, \
+                                  PRESENT_ROUND_COUNT_MAX + 1u);
+}  /* test_cache() */
+
+/*
+ * Key count and lookup count per reader of the threaded key cache test.
+ * The keys are many more than the slots, so the sets are evicted all the
+ * time.
+ */
+#define CACHE_THREAD_KEYS    (32u)
+#define CACHE_THREAD_LOOKUPS (20000u)
+#define CACHE_THREAD_READERS (4u)
+
+/**
+ * @brief Thread state of the threaded key cache test.
+ */
+typedef struct {
+    /*! Pointer of the shared cache. */
+    present_cache_t *     p_cache;
+    /*! Pointer of the expanded contexts of the keys. */
+    present_ctx_t const * p_checks;
+    /*! Pointer of the flag that stops the writer. */
+    bool *                p_stop;
+    /*! Seed of the key sequence. */
+    unsigned long         seed;
+    /*! Count of the lookups made by the thread. */
+    unsigned long         lookups;
+    /*! Count of the contexts that did not match their keys. */
+    unsigned long         errors;
+} cache_thread_t;
+
+/**
+ * @brief Makes a key of the threaded key cache test.
+ *
+ * @param[out] p_key Pointer of the key.
+ * @param[in]  index Index of the key.
+ *
+ * @return None.
+ */
+static void cache_thread_key(uint8_t * p_key, size_t index)
+{
+    memset(p_key, 0xA5u, PRESENT_KEY128_SIZE);
+    p_key[0] = (uint8_t)index;
+    p_key[9] = (uint8_t)(index * 29u);
+}  /* cache_thread_key() */
+
+/**
+ * @brief Gets a key from the cache and checks its context.
+ *
+ * @param[in,out] p_thread Pointer of the thread state.
+ * @param[in]     index    Index of the key.
+ *
+ * @return None.
+ */
+static void cache_thread_get(cache_thread_t * p_thread, size_t index)
+{
+    present_ctx_t const * p_check = &p_thread->p_checks[index];
+    present_ctx_t         ctx;
+    uint8_t               key[PRESENT_KEY128_SIZE];
+
+    cache_thread_key(key, index);
+
+    if (!present_cache_get(p_thread->p_cache, key, sizeof(key), &ctx)
+        || (0 != memcmp(ctx.round_key, p_check->round_key, \
+                        sizeof(ctx.round_key)))
+        || (0 != memcmp(ctx.inv_round_key, p_check->inv_round_key, \
+                        sizeof(ctx.inv_round_key)))
+        || (ctx.rounds != p_check->rounds))
+    {
+        p_thread->errors++;
+    }
+
+    p_thread->lookups++;
+}  /* cache_thread_get() */
+
+/**
+ * @brief Reader thread of the threaded key cache test.
+ *
+ * The thread gets the keys in a pseudo-random order that prefers a few of
+ * them, so that the lookups both hit and miss.
+ *
+ * @param[in,out] p_arg Pointer of the thread state.
+ *
+ * @return NULL.
+ */
+static void * cache_reader(void * p_arg)
+{
+    cache_thread_t * p_thread = (cache_thread_t *)p_arg;
+    unsigned long    state    = p_thread->seed;
+    unsigned long    lookup;
+
+    for (lookup = 0u; lookup < CACHE_THREAD_LOOKUPS; lookup++)
+    {
+        state = (state * 1103515245ul + 12345ul) & 0x7FFFFFFFul;
+
+        cache_thread_get(p_thread, (0u == (state & 0x300ul)) \
+                                   ? ((state >> 16) % CACHE_THREAD_KEYS) \
+                                   : ((state >> 16) % 6u));
+    }
+
+    return NULL;
+}  /* cache_reader() */
+
+/**
+ * @brief Writer thread of the threaded key cache test.
+ *
+ * The thread gets all the keys in turn until it is stopped, so that it
+ * inserts a key and evicts another one at almost every call.
+ *
+ * @param[in,out] p_arg Pointer of the thread state.
+ *
+ * @return NULL.
+ */
+static void * cache_writer(void * p_arg)
+{
+    cache_thread_t * p_thread = (cache_thread_t *)p_arg;
+    size_t           index    = 0u;
+
+    while (!__atomic_load_n(p_thread->p_stop, __ATOMIC_RELAXED))
+    {
+        cache_thread_get(p_thread, index);
+        index = (index + 1u) % CACHE_THREAD_KEYS;
+    }
+
+    return NULL;
+}  /* cache_writer() */
+
+/**
+ * @brief Threaded test function of the key cache.
+ *
+ * The function runs several readers and a writer on a small cache at the
+ * same time. It checks that every context matches its key, and that every
+ * lookup is counted either as a hit or as a miss.
+ *
+ * @return None.
+ */
+void test_cache_threads(void)
+{
+    present_cache_slot_t slots[2u * PRESENT_CACHE_WAYS];
+    present_cache_t      cache;
+    present_ctx_t        checks[CACHE_THREAD_KEYS];
+    cache_thread_t       threads[CACHE_THREAD_READERS + 1u];
+    pthread_t            ids[ARRAY_SIZE(threads)];
+    uint8_t              key[PRESENT_KEY128_SIZE];
+    unsigned long        lookups = 0u;
+    unsigned long        hits;
+    unsigned long        misses;
+    bool                 stop    = false;
+    size_t               thread;
+    size_t               index;
+
+    present_cache_init(&cache, slots, ARRAY_SIZE(slots));
+
+    for (index = 0u; index < CACHE_THREAD_KEYS; index++)
+    {
+        cache_thread_key(key, index);
+        TEST_ASSERT_TRUE(present_key_setup(&checks[index], key, \
+                                           sizeof(key)));
+    }
+
+    for (thread = 0u; thread < ARRAY_SIZE(threads); thread++)
+    {
+        threads[thread].p_cache  = &cache;
+        threads[thread].p_checks = checks;
+        threads[thread].p_stop   = &stop;
+        threads[thread].seed     = thread * 7919u + 1u;
+        threads[thread].lookups  = 0u;
+        threads[thread].errors   = 0u;
+    }
+
+    /*
+     * The last thread is the writer. It starts first, so that the readers
+     * run against it from their first lookup.
+     */
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&ids[CACHE_THREAD_READERS], \
+                                            NULL, cache_writer, \
+                                            &threads[CACHE_THREAD_READERS]));
+
+    for (thread = 0u; thread < CACHE_THREAD_READERS; thread++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&ids[thread], NULL, \
+                                                cache_reader, \
+                                                &threads[thread]));
+    }
+
+    for (thread = 0u; thread < CACHE_THREAD_READERS; thread++)
+    {
+        TEST_ASSERT_EQUAL_INT(0, pthread_join(ids[thread], NULL));
+    }
+
+    __atomic_store_n(&stop, true, __ATOMIC_RELAXED);
+    TEST_ASSERT_EQUAL_INT(0, pthread_join(ids[thread], NULL));
+
+    for (thread = 0u; thread < ARRAY_SIZE(threads); thread++)
+    {
+        TEST_ASSERT_EQUAL_UINT32(0u, threads[thread].errors);
+        lookups += threads[thread].lookups;
+    }
+
+    present_cache_stats(&cache, &hits, &misses);
+    TEST_ASSERT_EQUAL_UINT64(lookups, hits + misses);
+    TEST_ASSERT_TRUE(hits > 0u);
+    TEST_ASSERT_TRUE(misses > 0u);
+}  /* test_cache_threads() */
+
+/**
+ * @brief Test function of the counter mode.
+ *
+ * The function checks the keystream against the encrypted counter blocks
+ * with a counter that wraps inside its space, checks that a message
+ * processed in parts gives the same result, and checks that the input past
+ * the counter space is refused.
+ *
+ * @return None.
+ */
+void test_ctr(void)
+{
+    static uint8_t plain[300u * PRESENT_CRYPT_SIZE + 5u];
+    static uint8_t check[sizeof(plain)];
+    static uint8_t crypt[sizeof(plain)];
+    uint8_t        iv[] = {0x80u, 0x1Fu, 0x57u, 0x9Bu, \
+                           0xDFu, 0x02u, 0x46u, 0x8Au};
+    uint8_t        block[PRESENT_CRYPT_SIZE];
+    present_ctx_t  ctx;
+    present_ctr_t  ctr;
+    size_t         counter;
+    size_t         byte;
+    size_t         part;
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 37u + 3u);
+    }
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_2, sizeof(key_2)));
+
+    TEST_ASSERT_FALSE(present_ctr_init(&ctr, &ctx, iv, 0u));
+    TEST_ASSERT_FALSE(present_ctr_init(&ctr, &ctx, iv, 65u));
+
+    /*
+     * The 12-bit counter starts at 0xF80 and wraps from 0xFFF to 0x000
+     * without changing the nonce. The message takes 301 of its 4096
+     * blocks, so no counter block is used twice.
+     */
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        if (0u == (byte % PRESENT_CRYPT_SIZE))
+        {
+            counter = (0xF80u + byte / PRESENT_CRYPT_SIZE) & 0xFFFu;
+
+            memcpy(block, iv, sizeof(block));
+            block[0] = (uint8_t)counter;
+            block[1] = (uint8_t)((iv[1] & 0xF0u) | (counter >> 8));
+            present_ctx_encrypt(&ctx, block);
+        }
+
+        check[byte] = plain[byte] ^ block[byte % PRESENT_CRYPT_SIZE];
+    }
+
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 12u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, crypt, plain, sizeof(plain)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(crypt));
+
+    /*
+     * Process the message in parts that split the blocks.
+     */
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 12u));
+
+    for (byte = 0u, part = 1u; byte < sizeof(plain); byte += part)
+    {
+        part = (part * 7u) % 53u;
+        part = (part < sizeof(plain) - byte) ? part : sizeof(plain) - byte;
+
+        TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, &crypt[byte], \
+                                           &plain[byte], part));
+    }
+
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(crypt));
+
+    /*
+     * A 4-bit counter has 16 blocks. A longer message is refused as a
+     * whole, and the last bytes of the last block are still served.
+     */
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 4u));
+    TEST_ASSERT_FALSE(present_ctr_crypt(&ctr, crypt, plain, \
+                                        16u * PRESENT_CRYPT_SIZE + 1u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, crypt, plain, \
+                                       16u * PRESENT_CRYPT_SIZE - 3u));
+    TEST_ASSERT_FALSE(present_ctr_crypt(&ctr, crypt, plain, 4u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, crypt, plain, 3u));
+    TEST_ASSERT_FALSE(present_ctr_check(&ctr, 1u));
+    TEST_ASSERT_TRUE(present_ctr_check(&ctr, 0u));
+
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 64u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, crypt, plain, sizeof(plain)));
+
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 64u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, crypt, crypt, sizeof(crypt)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plain, crypt, sizeof(crypt));
+}  /* test_ctr() */
+
+/**
+ * @brief Test function of the CBC mode.
+ *
+ * The function checks the CBC encryption against chained single block
+ * encryptions, and the in-place decryption in parts with every engine.
+ *
+ * @return None.
+ */
+void test_cbc(void)
+{
+    static uint8_t      plain[300u * PRESENT_CRYPT_SIZE];
+    static uint8_t      check[sizeof(plain)];
+    static uint8_t      crypt[sizeof(plain)];
+    uint8_t const       iv[] = {0x2Eu, 0x13u, 0x57u, 0x9Bu, \
+                                0xDFu, 0x02u, 0x46u, 0x8Au};
+    uint8_t             chain[PRESENT_CRYPT_SIZE];
+    present_ctx_t       ctx;
+    present_engine_id_t engine;
+    size_t              byte;
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 37u + 3u);
+    }
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_2, sizeof(key_2)));
+
+    memcpy(chain, iv, sizeof(chain));
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        check[byte] = plain[byte] ^ chain[byte % PRESENT_CRYPT_SIZE];
+
+        if (PRESENT_CRYPT_SIZE - 1u == (byte % PRESENT_CRYPT_SIZE))
+        {
+            present_ctx_encrypt(&ctx, &check[byte + 1u - PRESENT_CRYPT_SIZE]);
+            memcpy(chain, &check[byte + 1u - PRESENT_CRYPT_SIZE], \
+                   sizeof(chain));
+        }
+    }
+
+    memcpy(chain, iv, sizeof(chain));
+    present_cbc_encrypt(&ctx, chain, crypt, plain, 300u);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(crypt));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(&check[299u * PRESENT_CRYPT_SIZE], chain, \
+                                 sizeof(chain));
+
+    for (engine = PRESENT_ENGINE_REF; engine < PRESENT_ENGINE_COUNT;
+         engine++)
+    {
+        if (!present_set_engine(engine))
+        {
+            continue;
+        }
+
+        memcpy(crypt, check, sizeof(crypt));
+        memcpy(chain, iv, sizeof(chain));
+
+        present_cbc_decrypt(&ctx, chain, crypt, crypt, 1u);
+        present_cbc_decrypt(&ctx, chain, &crypt[PRESENT_CRYPT_SIZE], \
+                            &crypt[PRESENT_CRYPT_SIZE], 299u);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(plain, crypt, sizeof(crypt));
+    }
+
+    present_reset_engine();
+}  /* test_cbc() */
+
+/**
+ * @brief Test function of the multi-buffer manager.
+ *
+ * The function submits more jobs than the lanes, with different lengths
+ * and with both CBC encryption and CBC-MAC, and checks every job against
+ * the CBC mode.
+ *
+ * @return None.
+ */
+void test_mb(void)
+{
+    static present_mb_job_t jobs[PRESENT_MB_LANES + 9u];
+    static uint8_t          plain[40u * PRESENT_CRYPT_SIZE];
+    static uint8_t          crypt[ARRAY_SIZE(jobs)][sizeof(plain)];
+    uint8_t                 check[sizeof(plain)];
+    uint8_t                 chain[PRESENT_CRYPT_SIZE];
+    present_mb_mgr_t        mgr;
+    present_mb_job_t *      p_job;
+    present_ctx_t           ctx;
+    size_t                  returned = 0u;
+    size_t                  job;
+    size_t                  byte;
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 37u + 3u);
+    }
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_2, sizeof(key_2)));
+    present_mb_init(&mgr, &ctx);
+
+    TEST_ASSERT_NULL(present_mb_flush(&mgr));
+
+    for (job = 0u; job < ARRAY_SIZE(jobs); job++)
+    {
+        jobs[job].p_dst  = (job % 3u) ? crypt[job] : NULL;
+        jobs[job].p_src  = plain;
+        jobs[job].count  = (job * 7u) % 41u;
+        jobs[job].p_user = &jobs[job];
+        memset(jobs[job].chain, (int)job, sizeof(jobs[job].chain));
+
+        if (NULL != present_mb_submit(&mgr, &jobs[job]))
+        {
+            returned++;
+        }
+    }
+
+    while (NULL != (p_job = present_mb_flush(&mgr)))
+    {
+        TEST_ASSERT_EQUAL_PTR(p_job, p_job->p_user);
+        returned++;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(ARRAY_SIZE(jobs), returned);
+
+    for (job = 0u; job < ARRAY_SIZE(jobs); job++)
+    {
+        memset(chain, (int)job, sizeof(chain));
+        present_cbc_encrypt(&ctx, chain, check, plain, jobs[job].count);
+
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(chain, jobs[job].chain, sizeof(chain));
+
+        if ((NULL != jobs[job].p_dst) && (jobs[job].count > 0u))
+        {
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt[job], \
+                                         jobs[job].count * PRESENT_CRYPT_SIZE);
+        }
+    }
+}  /* test_mb() */
+
+/**
+ * @brief Test function of the streaming interface.
+ *
+ * The function processes a padded message in fragments of different sizes
+ * in both modes, and checks the result against the block functions. The
+ * invalid paddings and the partial blocks without padding must fail.
+ *
+ * @return None.
+ */
+void test_stream(void)
+{
+    static uint8_t        plain[203u * PRESENT_CRYPT_SIZE];
+    static uint8_t        check[sizeof(plain)];
+    static uint8_t        crypt[sizeof(plain)];
+    uint8_t const         iv[] = {0x2Eu, 0x13u, 0x57u, 0x9Bu, \
+                                  0xDFu, 0x02u, 0x46u, 0x8Au};
+    uint8_t               chain[PRESENT_CRYPT_SIZE];
+    present_stream_mode_t mode;
+    present_stream_t      stream;
+    present_ctx_t         ctx;
+    size_t const          size = sizeof(plain) - 5u;
+    size_t                written;
+    size_t                byte;
+    size_t                part;
+
+    for (byte = 0u; byte < size; byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 37u + 3u);
+    }
+
+    /*
+     * The padding fills the last block with its length.
+     */
+    memset(&plain[size], 5, sizeof(plain) - size);
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_2, sizeof(key_2)));
+
+    for (mode = PRESENT_STREAM_ECB; mode <= PRESENT_STREAM_CBC; mode++)
+    {
+        memcpy(chain, iv, sizeof(chain));
+
+        if (PRESENT_STREAM_CBC == mode)
+        {
+            present_cbc_encrypt(&ctx, chain, check, plain, 203u);
+        }
+        else
+        {
+            present_encrypt_blocks(&ctx, check, plain, 203u);
+        }
+
+        present_stream_init(&stream, &ctx, mode, true, true, iv);
+
+        for (byte = 0u, written = 0u, part = 1u; byte < size; byte += part)
+        {
+            part = (part * 7u) % 53u;
+            part = (part < size - byte) ? part : size - byte;
+
+            written += present_stream_update(&stream, &crypt[written], \
+                                             &plain[byte], part);
+        }
+
+        TEST_ASSERT_TRUE(present_stream_final(&stream, &crypt[written], \
+                                              &part));
+        TEST_ASSERT_EQUAL_UINT32(sizeof(crypt), written + part);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(crypt));
+
+        /*
+         * Decrypt in fragments that end at the block boundaries, so that
+         * the last block is held back.
+         */
+        memset(crypt, 0, sizeof(crypt));
+        present_stream_init(&stream, &ctx, mode, false, true, iv);
+
+        for (byte = 0u, written = 0u; byte < sizeof(check); byte += part)
+        {
+            part = (0u == byte) ? 3u * PRESENT_CRYPT_SIZE : 5u;
+            part = (part < sizeof(check) - byte) ? part
+                                                  : sizeof(check) - byte;
+
+            written += present_stream_update(&stream, &crypt[written], \
+                                             &check[byte], part);
+        }
+
+        TEST_ASSERT_TRUE(present_stream_final(&stream, &crypt[written], \
+                                              &part));
+        TEST_ASSERT_EQUAL_UINT32(size, written + part);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(plain, crypt, size);
+    }
+
+    /*
+     * A message with a wrong padding byte.
+     */
+    plain[sizeof(plain) - 2u] = 4u;
+    present_encrypt_blocks(&ctx, check, plain, 203u);
+
+    present_stream_init(&stream, &ctx, PRESENT_STREAM_ECB, false, true, NULL);
+    written = present_stream_update(&stream, crypt, check, sizeof(check));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(check) - PRESENT_CRYPT_SIZE, written);
+    TEST_ASSERT_FALSE(present_stream_final(&stream, crypt, &part));
+
+    present_stream_init(&stream, &ctx, PRESENT_STREAM_ECB, true, false, NULL);
+    written = present_stream_update(&stream, crypt, plain, size);
+    TEST_ASSERT_EQUAL_UINT32(size - size % PRESENT_CRYPT_SIZE, written);
+    TEST_ASSERT_FALSE(present_stream_final(&stream, crypt, &part));
+}  /* test_stream() */
+
+/**
+ * @brief Test function of the out of place crypt functions.
+ *
+ * The function crypts blocks at unaligned addresses with every engine, and
+ * checks that the source blocks are not changed.
+ *
+ * @return None.
+ */
+void test_out_of_place(void)
+{
+    uint8_t             src[PRESENT_CRYPT_SIZE + 3u];
+    uint8_t             dst[PRESENT_CRYPT_SIZE + 3u];
+    present_ctx_t       ctx;
+    present_engine_id_t engine;
+
+    uint8_t const expected_1[] = {0x45u, 0x84u, 0x22u, 0x7Bu, \
+                                  0x38u, 0xC1u, 0x79u, 0x55u};
+
+    uint8_t const expected_2[] = {0xD2u, 0x10u, 0x32u, 0x21u, \
+                                  0xD3u, 0xDCu, 0x33u, 0x33u};
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_1, sizeof(key_1)));
+
+    for (engine = PRESENT_ENGINE_REF; engine < PRESENT_ENGINE_COUNT;
+         engine++)
+    {
+        if (!present_set_engine(engine))
+        {
+            continue;
+        }
+
+        memcpy(&src[1], decipher_1, PRESENT_CRYPT_SIZE);
+        present_ctx_encrypt_to(&ctx, &dst[3], &src[1]);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_1, &dst[3], PRESENT_CRYPT_SIZE);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(decipher_1, &src[1], \
+                                     PRESENT_CRYPT_SIZE);
+
+        memcpy(&src[3], expected_1, PRESENT_CRYPT_SIZE);
+        present_ctx_decrypt_to(&ctx, &dst[1], &src[3]);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(decipher_1, &dst[1], \
+                                     PRESENT_CRYPT_SIZE);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_1, &src[3], PRESENT_CRYPT_SIZE);
+    }
+
+    present_reset_engine();
+
+    memcpy(&src[1], decipher_4, PRESENT_CRYPT_SIZE);
+    present_encrypt_to(&dst[1], &src[1], key_4);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_2, &dst[1], PRESENT_CRYPT_SIZE);
+
+    present_decrypt_to(&src[2], &dst[1], key_4);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(decipher_4, &src[2], PRESENT_CRYPT_SIZE);
+}  /* test_out_of_place() */
+
+/**
+ * @brief Splits a buffer into a chain.
+ *
+ * The function fills \a p_iov with the consecutive parts of \a p_buffer
+ * whose sizes are given by \a p_sizes.
+ *
+ * @param[out] p_iov    Pointer of the buffer chain.
+ * @param[in]  p_buffer Pointer of the buffer.
+ * @param[in]  p_sizes  Pointer of the part sizes.
+ * @param[in]  count    Count of the parts.
+ *
+ * @return None.
+ */
+static void split_iov(struct iovec * p_iov, uint8_t * p_buffer, \
+                      size_t const * p_sizes, size_t count)
+{
+    size_t part;
+
+    for (part = 0u; part < count; part++)
+    {
+        p_iov[part].iov_base = p_buffer;
+        p_iov[part].iov_len  = p_sizes[part];
+        p_buffer            += p_sizes[part];
+    }
+}  /* split_iov() */
+
+/**
+ * @brief Test function of the scatter-gather interface.
+ *
+ * The function processes a message split into input and output chains of
+ * different layouts, and checks the result against the contiguous
+ * functions.
+ *
+ * @return None.
+ */
+void test_iov(void)
+{
+    static uint8_t   plain[600u];
+    static uint8_t   check[sizeof(plain) + PRESENT_CRYPT_SIZE];
+    static uint8_t   crypt[sizeof(check)];
+    uint8_t const    iv[] = {0x2Eu, 0x13u, 0x57u, 0x9Bu, \
+                             0xDFu, 0x02u, 0x46u, 0x8Au};
+    size_t const     src_sizes[] = {3u, 0u, 17u, 1u, 400u, 13u, 166u};
+    size_t const     dst_sizes[] = {5u, 1u, 2u, 0u, 301u, 7u, 3u, 289u};
+    struct iovec     src[ARRAY_SIZE(src_sizes)];
+    struct iovec     dst[ARRAY_SIZE(dst_sizes)];
+    present_stream_t stream;
+    present_ctr_t    ctr;
+    present_ctx_t    ctx;
+    size_t           written;
+    size_t           size;
+    size_t           byte;
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 37u + 3u);
+    }
+
+    split_iov(src, plain, src_sizes, ARRAY_SIZE(src_sizes));
+    split_iov(dst, crypt, dst_sizes, ARRAY_SIZE(dst_sizes));
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_2, sizeof(key_2)));
+
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 32u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, check, plain, sizeof(plain)));
+
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 32u));
+    TEST_ASSERT_TRUE(present_ctr_crypt_iov(&ctr, dst, ARRAY_SIZE(dst), \
+                                           src, ARRAY_SIZE(src)));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(plain));
+
+    /*
+     * The vector is refused as a whole when it passes the counter space.
+     */
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 4u));
+    TEST_ASSERT_FALSE(present_ctr_crypt_iov(&ctr, dst, ARRAY_SIZE(dst), \
+                                            src, ARRAY_SIZE(src)));
+    TEST_ASSERT_TRUE(present_ctr_check(&ctr, 16u * PRESENT_CRYPT_SIZE));
+
+    present_stream_init(&stream, &ctx, PRESENT_STREAM_CBC, true, true, iv);
+    size  = present_stream_update(&stream, check, plain, sizeof(plain));
+    TEST_ASSERT_TRUE(present_stream_final(&stream, &check[size], &byte));
+    size += byte;
+
+    present_stream_init(&stream, &ctx, PRESENT_STREAM_CBC, true, true, iv);
+    written = present_stream_update_iov(&stream, dst, ARRAY_SIZE(dst), \
+                                        src, ARRAY_SIZE(src));
+    TEST_ASSERT_TRUE(present_stream_final(&stream, &crypt[written], &byte));
+    TEST_ASSERT_EQUAL_UINT32(size, written + byte);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, size);
+}  /* test_iov() */
+
+/**
+ * @brief Test function of the multi-key batch interface.
+ *
+ * The function crypts the blocks of different keys by every supported
+ * engine and checks the result against the single block functions.
+ *
+ * @return None.
+ */
+void test_multi_key(void)
+{
+    static present_ctx_t  ctx[8u];
+    present_ctx_t const * p_ctx[45u];
+    present_engine_id_t   engine;
+    uint8_t               plain[sizeof(p_ctx) / sizeof(p_ctx[0])
+                                * PRESENT_CRYPT_SIZE];
+    uint8_t               check[sizeof(plain)];
+    uint8_t               crypt[sizeof(plain)];
+    uint8_t               key[PRESENT_KEY_SIZE];
+    size_t                block;
+    size_t                byte;
+
+    for (block = 0u; block < ARRAY_SIZE(ctx); block++)
+    {
+        for (byte = 0u; byte < sizeof(key); byte++)
+        {
+            key[byte] = (uint8_t)(block * 71u + byte * 13u + 1u);
+        }
+
+        TEST_ASSERT_TRUE(present_key_setup(&ctx[block], key, sizeof(key)));
+    }
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 47u + 9u);
+    }
+
+    /*
+     * Mix the keys irregularly, so that every lane sees different keys.
+     */
+    for (block = 0u; block < ARRAY_SIZE(p_ctx); block++)
+    {
+        p_ctx[block] = &ctx[(block * 5u + block / 8u) % ARRAY_SIZE(ctx)];
+
+        present_ctx_encrypt_to(p_ctx[block], \
+                               &check[block * PRESENT_CRYPT_SIZE], \
+                               &plain[block * PRESENT_CRYPT_SIZE]);
+    }
+
+    for (engine = PRESENT_ENGINE_REF; engine < PRESENT_ENGINE_COUNT; engine++)
+    {
+        if (!present_set_engine(engine))
+        {
+            continue;
+        }
+
+        TEST_ASSERT_TRUE(present_encrypt_multi(p_ctx, crypt, plain, \
+                                               ARRAY_SIZE(p_ctx)));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(crypt));
+
+        TEST_ASSERT_TRUE(present_decrypt_multi(p_ctx, crypt, crypt, \
+                                               ARRAY_SIZE(p_ctx)));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(plain, crypt, sizeof(crypt));
+    }
+
+    present_reset_engine();
+
+    /*
+     * The contexts of a batch must have the same round count.
+     */
+    TEST_ASSERT_TRUE(present_set_round_count(&ctx[3], 12u));
+    TEST_ASSERT_FALSE(present_encrypt_multi(p_ctx, crypt, plain, \
+                                            ARRAY_SIZE(p_ctx)));
+    TEST_ASSERT_FALSE(present_decrypt_multi(p_ctx, crypt, plain, \
+                                            ARRAY_SIZE(p_ctx)));
+}  /* test_multi_key() */
+
+/**
+ * @brief Test function of the batch key setup.
+ *
+ * The function expands batches of both key sizes by every supported engine
+ * and checks the contexts against the single key setup.
+ *
+ * @return None.
+ */
+void test_key_batch(void)
+{
+    static present_ctx_t ctx[11u];
+    static uint8_t       keys[ARRAY_SIZE(ctx) * PRESENT_KEY128_SIZE];
+    size_t const         sizes[] = {PRESENT_KEY80_SIZE, PRESENT_KEY128_SIZE};
+    present_engine_id_t  engine;
+    present_ctx_t        check;
+    size_t               size;
+    size_t               key;
+
+    for (key = 0u; key < sizeof(keys); key++)
+    {
+        keys[key] = (uint8_t)(key * 151u + 17u);
+    }
+
+    for (engine = PRESENT_ENGINE_REF; engine < PRESENT_ENGINE_COUNT; engine++)
+    {
+        if (!present_set_engine(engine))
+        {
+            continue;
+        }
+
+        for (size = 0u; size < ARRAY_SIZE(sizes); size++)
+        {
+            memset(ctx, 0, sizeof(ctx));
+
+            TEST_ASSERT_TRUE(present_key_setup_batch(ctx, keys, sizes[size], \
+                                                     ARRAY_SIZE(ctx)));
+
+            for (key = 0u; key < ARRAY_SIZE(ctx); key++)
+            {
+                TEST_ASSERT_TRUE(present_key_setup(&check, \
+                                                   &keys[key * sizes[size]], \
+                                                   sizes[size]));
+
+                TEST_ASSERT_EQUAL_HEX64_ARRAY(check.round_key, \
+                                              ctx[key].round_key, \
+                                              ARRAY_SIZE(check.round_key));
+                TEST_ASSERT_EQUAL_HEX64_ARRAY(check.inv_round_key, \
+                                              ctx[key].inv_round_key, \
+                                              ARRAY_SIZE(check.round_key));
+                TEST_ASSERT_EQUAL_UINT8(check.rounds, ctx[key].rounds);
+            }
+        }
+    }
+
+    present_reset_engine();
+
+    TEST_ASSERT_FALSE(present_key_setup_batch(ctx, keys, 12u, \
+                                              ARRAY_SIZE(ctx)));
+}  /* test_key_batch() */
+
+/**
+ * @brief Test function of the worker pool.
+ *
+ * The function runs ECB and counter mode calls that span several chunks
+ * on a pool, and checks them against the single thread functions.
+ *
+ * @return None.
+ */
+void test_pool(void)
+{
+    static uint8_t plain[5u * PRESENT_POOL_CHUNK + 13u];
+    static uint8_t check[sizeof(plain)];
+    static uint8_t crypt[sizeof(plain)];
+    uint8_t const  iv[] = {0x71u, 0xECu, 0xA5u, 0x3Eu, \
+                           0xFFu, 0xFFu, 0xFFu, 0xFFu};
+    size_t const   count = sizeof(plain) / PRESENT_CRYPT_SIZE;
+    present_pool_t pool;
+    present_ctr_t  ctr;
+    present_ctx_t  ctx;
+    size_t         byte;
+
+    for (byte = 0u; byte < sizeof(plain); byte++)
+    {
+        plain[byte] = (uint8_t)(byte * 43u + 19u);
+    }
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_3, sizeof(key_3)));
+    TEST_ASSERT_TRUE(present_pool_init(&pool, 4u, PRESENT_CRYPT_SIZE, true));
+
+    present_encrypt_blocks(&ctx, check, plain, count);
+    present_pool_encrypt_blocks(&pool, &ctx, crypt, plain, count);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, count * PRESENT_CRYPT_SIZE);
+
+    present_pool_decrypt_blocks(&pool, &ctx, crypt, crypt, count);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(plain, crypt, count * PRESENT_CRYPT_SIZE);
+
+    /*
+     * Start in the middle of a keystream block, and let the counter wrap
+     * around in one of the chunks. The 16-bit counter starts at 0xEC71 and
+     * the message takes 20482 of its 65536 blocks.
+     */
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 16u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, check, plain, 3u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, &check[3], &plain[3], \
+                                       sizeof(plain) - 3u));
+
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 16u));
+    TEST_ASSERT_TRUE(present_ctr_crypt(&ctr, crypt, plain, 3u));
+    TEST_ASSERT_TRUE(present_pool_ctr_crypt(&pool, &ctr, &crypt[3], \
+                                            &plain[3], sizeof(plain) - 6u));
+    TEST_ASSERT_TRUE(present_pool_ctr_crypt(&pool, &ctr, \
+                                            &crypt[sizeof(plain) - 3u], \
+                                            &plain[sizeof(plain) - 3u], 3u));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, sizeof(plain));
+
+    /*
+     * The chunks are not started when the message passes the counter space.
+     */
+    TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 4u));
+    TEST_ASSERT_FALSE(present_pool_ctr_crypt(&pool, &ctr, crypt, plain, \
+                                             17u * PRESENT_CRYPT_SIZE));
+    TEST_ASSERT_TRUE(present_ctr_check(&ctr, 16u * PRESENT_CRYPT_SIZE));
+
+    present_pool_destroy(&pool);
+
+    /*
+     * The calls below the threshold run on the caller.
+     */
+    TEST_ASSERT_TRUE(present_pool_init(&pool, 0u, SIZE_MAX, false));
+    present_pool_encrypt_blocks(&pool, &ctx, crypt, plain, count);
+    present_encrypt_blocks(&ctx, check, plain, count);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt, count * PRESENT_CRYPT_SIZE);
+    present_pool_destroy(&pool);
+}  /* test_pool() */
+
+/**
+ * @brief Test function of the work-stealing scheduler.
+ *
+ * The function submits messages of different sizes and modes to a
+ * scheduler, and checks them against the single thread functions.
+ *
+ * @return None.
+ */
+void test_sched(void)
+{
+    static present_sched_t       sched;
+    static present_sched_job_t   jobs[200];
+    static present_sched_job_t * p_jobs[ARRAY_SIZE(jobs) + 1u];
+    static uint8_t               plain[ARRAY_SIZE(jobs)][520];
+    static uint8_t               crypt[ARRAY_SIZE(jobs)][520];
+    uint8_t                      check[520];
+    uint8_t                      iv[PRESENT_CRYPT_SIZE];
+    present_sched_job_t          odd;
+    present_sched_stats_t        stats;
+    present_ctr_t                ctr;
+    present_ctx_t                ctx;
+    size_t                       job;
+    size_t                       byte;
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_4, sizeof(key_4)));
+    TEST_ASSERT_TRUE(present_sched_init(&sched, 4u));
+
+    for (job = 0u; job < ARRAY_SIZE(jobs); job++)
+    {
+        for (byte = 0u; byte < sizeof(plain[job]); byte++)
+        {
+            plain[job][byte] = (uint8_t)(job * 7u + byte * 13u);
+        }
+
+        for (byte = 0u; byte < sizeof(jobs[job].iv); byte++)
+        {
+            jobs[job].iv[byte] = (uint8_t)(job + byte);
+        }
+
+        /*
+         * Mix short and long messages, so that the workers steal.
+         */
+        jobs[job].op           = (present_sched_op_t)(job % 5u);
+        jobs[job].p_ctx        = &ctx;
+        jobs[job].p_dst        = crypt[job];
+        jobs[job].p_src        = plain[job];
+        jobs[job].size         = (0u == job % 7u) ? 520u : (job % 9u) * 8u;
+        jobs[job].counter_bits = 16u;
+        p_jobs[job]            = &jobs[job];
+    }
+
+    /*
+     * An ECB message must be made of whole blocks.
+     */
+    odd       = jobs[0];
+    odd.op    = PRESENT_SCHED_ECB_ENCRYPT;
+    odd.p_dst = check;
+    odd.size  = 13u;
+
+    p_jobs[ARRAY_SIZE(jobs)] = &odd;
+
+    TEST_ASSERT_EQUAL(ARRAY_SIZE(p_jobs), \
+                      present_sched_submit(&sched, p_jobs, \
+                                           ARRAY_SIZE(p_jobs)));
+    present_sched_wait(&sched);
+
+    TEST_ASSERT_FALSE(odd.ok);
+    TEST_ASSERT_TRUE(odd.done);
+
+    for (job = 0u; job < ARRAY_SIZE(jobs); job++)
+    {
+        TEST_ASSERT_TRUE(jobs[job].ok);
+        TEST_ASSERT_TRUE(jobs[job].done);
+        TEST_ASSERT_TRUE(jobs[job].submit_ns <= jobs[job].start_ns);
+        TEST_ASSERT_TRUE(jobs[job].start_ns <= jobs[job].done_ns);
+
+        for (byte = 0u; byte < sizeof(iv); byte++)
+        {
+            iv[byte] = (uint8_t)(job + byte);
+        }
+
+        switch (jobs[job].op)
+        {
+            case PRESENT_SCHED_ECB_ENCRYPT:
+                present_encrypt_blocks(&ctx, check, plain[job], \
+                                       jobs[job].size / 8u);
+                break;
+
+            case PRESENT_SCHED_ECB_DECRYPT:
+                present_decrypt_blocks(&ctx, check, plain[job], \
+                                       jobs[job].size / 8u);
+                break;
+
+            case PRESENT_SCHED_CBC_ENCRYPT:
+                present_cbc_encrypt(&ctx, iv, check, plain[job], \
+                                    jobs[job].size / 8u);
+                break;
+
+            case PRESENT_SCHED_CBC_DECRYPT:
+                present_cbc_decrypt(&ctx, iv, check, plain[job], \
+                                    jobs[job].size / 8u);
+                break;
+
+            default:
+                TEST_ASSERT_TRUE(present_ctr_init(&ctr, &ctx, iv, 16u));
+                present_ctr_crypt(&ctr, check, plain[job], jobs[job].size);
+                break;
+        }
+
+        if (jobs[job].size > 0u)
+        {
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt[job], jobs[job].size);
+        }
+    }
+
+    present_sched_stats(&sched, &stats);
+    TEST_ASSERT_EQUAL(ARRAY_SIZE(p_jobs), stats.submitted);
+    TEST_ASSERT_EQUAL(ARRAY_SIZE(p_jobs), stats.completed);
+    TEST_ASSERT_TRUE(stats.busy_ns <= stats.capacity_ns);
+
+    present_sched_destroy(&sched);
+}  /* test_sched() */
+
+/**
+ * @brief Test function of the asynchronous queue.
+ *
+ * The function submits jobs to a queue, reaps their completions by the
+ * blocking and the polling calls, and checks the messages against the
+ * single thread functions.
+ *
+ * @return None.
+ */
+void test_async(void)
+{
+    static present_async_t     async;
+    static present_async_sqe_t sqes[PRESENT_ASYNC_ENTRIES + 8u];
+    static present_async_cqe_t cqes[ARRAY_SIZE(sqes)];
+    static uint8_t             plain[ARRAY_SIZE(sqes)][64];
+    static uint8_t             crypt[ARRAY_SIZE(sqes)][64];
+    static bool                seen[ARRAY_SIZE(sqes)];
+    uint8_t                    check[64];
+    present_ctx_t              ctx;
+    size_t                     submitted;
+    size_t                     reaped = 0u;
+    size_t                     taken;
+    size_t                     entry;
+    size_t                     byte;
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_2, sizeof(key_2)));
+    TEST_ASSERT_TRUE(present_async_init(&async, 3u));
+
+#if defined(__linux__)
+    TEST_ASSERT_TRUE(present_async_fd(&async) >= 0);
+#endif  /* __linux__ */
+
+    for (entry = 0u; entry < ARRAY_SIZE(sqes); entry++)
+    {
+        for (byte = 0u; byte < sizeof(plain[entry]); byte++)
+        {
+            plain[entry][byte] = (uint8_t)(entry * 3u + byte * 29u);
+        }
+
+        sqes[entry].op        = PRESENT_SCHED_ECB_ENCRYPT;
+        sqes[entry].p_ctx     = &ctx;
+        sqes[entry].p_dst     = crypt[entry];
+        sqes[entry].p_src     = plain[entry];
+        sqes[entry].size      = sizeof(plain[entry]);
+        sqes[entry].priority  = PRESENT_ASYNC_HIGH;
+        sqes[entry].user_data = entry;
+    }
+
+    /*
+     * The last job is not made of whole blocks, so it fails.
+     */
+    sqes[ARRAY_SIZE(sqes) - 1u].size = 9u;
+
+    /*
+     * No more than the ring size could be in flight.
+     */
+    submitted = present_async_submit(&async, sqes, ARRAY_SIZE(sqes));
+    TEST_ASSERT_EQUAL(PRESENT_ASYNC_ENTRIES, submitted);
+
+    while (reaped < ARRAY_SIZE(sqes))
+    {
+        taken = present_async_wait(&async, &cqes[reaped], \
+                                   ARRAY_SIZE(cqes) - reaped);
+        TEST_ASSERT_TRUE(taken > 0u);
+
+        reaped    += taken;
+        submitted += present_async_submit(&async, &sqes[submitted], \
+                                          ARRAY_SIZE(sqes) - submitted);
+    }
+
+    TEST_ASSERT_EQUAL(0u, present_async_wait(&async, cqes, 1u));
+    TEST_ASSERT_EQUAL(0u, present_async_reap(&async, cqes, 1u));
+
+    for (entry = 0u; entry < ARRAY_SIZE(cqes); entry++)
+    {
+        TEST_ASSERT_TRUE(cqes[entry].user_data < ARRAY_SIZE(sqes));
+        TEST_ASSERT_FALSE(seen[cqes[entry].user_data]);
+
+        seen[cqes[entry].user_data] = true;
+
+        TEST_ASSERT_EQUAL(ARRAY_SIZE(sqes) - 1u != cqes[entry].user_data, \
+                          cqes[entry].ok);
+    }
+
+    for (entry = 0u; entry < ARRAY_SIZE(sqes) - 1u; entry++)
+    {
+        present_encrypt_blocks(&ctx, check, plain[entry], \
+                               sizeof(check) / PRESENT_CRYPT_SIZE);
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt[entry], sizeof(check));
+    }
+
+    present_async_destroy(&async);
+}  /* test_async() */
+
+/**
+ * @brief Test function of the priority classes of the asynchronous queue.
+ *
+ * The function submits bulk jobs of every mode that span many chunks,
+ * followed by a high priority job, to a single worker. The high priority
+ * job must not wait for all the bulk jobs, and the chunked messages must
+ * match the single thread ones.
+ *
+ * @return None.
+ */
+void test_async_priority(void)
+{
+    static present_async_t     async;
+    static uint8_t             plain[4u][128u * PRESENT_ASYNC_CHUNK];
+    static uint8_t             crypt[ARRAY_SIZE(plain)][sizeof(plain[0])];
+    static uint8_t             check[sizeof(plain[0])];
+    present_async_sqe_t        sqes[ARRAY_SIZE(plain) + 1u];
+    present_async_cqe_t        cqes[ARRAY_SIZE(sqes)];
+    present_async_hist_t       hist;
+    present_sched_op_t const   ops[] = {PRESENT_SCHED_CTR, \
+                                        PRESENT_SCHED_CBC_ENCRYPT, \
+                                        PRESENT_SCHED_ECB_ENCRYPT, \
+                                        PRESENT_SCHED_CBC_DECRYPT};
+    uint8_t                    small[PRESENT_CRYPT_SIZE] = {0u};
+    uint8_t                    iv[PRESENT_CRYPT_SIZE];
+    present_ctx_t              ctx;
+    size_t                     reaped = 0u;
+    size_t                     high   = ARRAY_SIZE(cqes);
+    size_t                     entry;
+    size_t                     byte;
+
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_1, sizeof(key_1)));
+    TEST_ASSERT_TRUE(present_async_init(&async, 1u));
+
+    for (entry = 0u; entry < ARRAY_SIZE(sqes); entry++)
+    {
+        for (byte = 0u; byte < sizeof(iv); byte++)
+        {
+            sqes[entry].iv[byte] = (uint8_t)(entry * 11u + byte);
+        }
+
+        sqes[entry].p_ctx        = &ctx;
+        sqes[entry].counter_bits = 24u;
+        sqes[entry].user_data    = entry;
+    }
+
+    for (entry = 0u; entry < ARRAY_SIZE(plain); entry++)
+    {
+        for (byte = 0u; byte < sizeof(plain[entry]); byte++)
+        {
+            plain[entry][byte] = (uint8_t)(entry + byte * 5u);
+        }
+
+        sqes[entry].op       = ops[entry];
+        sqes[entry].p_dst    = crypt[entry];
+        sqes[entry].p_src    = plain[entry];
+        sqes[entry].size     = sizeof(plain[entry]);
+        sqes[entry].priority = PRESENT_ASYNC_BULK;
+    }
+
+    sqes[ARRAY_SIZE(plain)].op       = PRESENT_SCHED_ECB_ENCRYPT;
+    sqes[ARRAY_SIZE(plain)].p_dst    = small;
+    sqes[ARRAY_SIZE(plain)].p_src    = small;
+    sqes[ARRAY_SIZE(plain)].size     = sizeof(small);
+    sqes[ARRAY_SIZE(plain)].priority = PRESENT_ASYNC_HIGH;
+
+    TEST_ASSERT_EQUAL(ARRAY_SIZE(sqes), \
+                      present_async_submit(&async, sqes, ARRAY_SIZE(sqes)));
+
+    while (reaped < ARRAY_SIZE(cqes))
+    {
+        reaped += present_async_wait(&async, &cqes[reaped], \
+                                     ARRAY_SIZE(cqes) - reaped);
+    }
+
+    for (entry = 0u; entry < ARRAY_SIZE(cqes); entry++)
+    {
+        TEST_ASSERT_TRUE(cqes[entry].ok);
+
+        if (ARRAY_SIZE(plain) == cqes[entry].user_data)
+        {
+            high = entry;
+        }
+    }
+
+    /*
+     * The worker takes the high priority job between two chunks of the
+     * first bulk job at the latest.
+     */
+    TEST_ASSERT_TRUE(high < ARRAY_SIZE(plain));
+
+    for (entry = 0u; entry < ARRAY_SIZE(plain); entry++)
+    {
+        for (byte = 0u; byte < sizeof(iv); byte++)
+        {
+            iv[byte] = (uint8_t)(entry * 11u + byte);
+        }
+
+        TEST_ASSERT_TRUE(present_sched_crypt(ops[entry], &ctx, iv, 24u, \
+                                             check, plain[entry], \
+                                             sizeof(check)));
+        TEST_ASSERT_EQUAL_HEX8_ARRAY(check, crypt[entry], sizeof(check));
+    }
+
+    present_async_hist(&async, PRESENT_ASYNC_HIGH, &hist);
+    TEST_ASSERT_EQUAL(1u, hist.count);
+    TEST_ASSERT_TRUE(present_async_percentile(&hist, 99u) > 0u);
+
+    present_async_hist(&async, PRESENT_ASYNC_BULK, &hist);
+    TEST_ASSERT_EQUAL(ARRAY_SIZE(plain), hist.count);
+    TEST_ASSERT_TRUE(present_async_percentile(&hist, 50u)
+                     <= present_async_percentile(&hist, 100u));
+
+    present_async_destroy(&async);
+}  /* test_async_priority() */
+
+/**
+ * @brief Test function of the NUMA support.
+ *
+ * The function reads the topology, allocates a buffer on huge pages, asks
+ * the nodes of its pages, and runs a pool call of several rounds on it.
+ * The calls that depend on the kernel could fail on the hosts without
+ * NUMA, so only their outputs are checked.
+ *
+ * @return None.
+ */
+void test_numa(void)
+{
+    size_t const   size  = (2u * PRESENT_POOL_ROUND + 3u) * PRESENT_POOL_CHUNK;
+    size_t const   count = size / PRESENT_CRYPT_SIZE;
+    void const *   p_addrs[4];
+    size_t         nodes[ARRAY_SIZE(p_addrs)];
+    present_numa_t numa;
+    present_pool_t pool;
+    present_ctx_t  ctx;
+    uint8_t *      p_buf;
+    bool           huge;
+    size_t         byte;
+    size_t         page;
+
+    present_numa_init(&numa);
+    TEST_ASSERT_TRUE(numa.node_count >= 1u);
+    TEST_ASSERT_TRUE(present_numa_current(&numa) < numa.node_count);
+
+    p_buf = present_numa_alloc(size, &huge);
+    TEST_ASSERT_NOT_NULL(p_buf);
+    TEST_ASSERT_EQUAL(0u, (uintptr_t)p_buf % PRESENT_NUMA_HUGE_PAGE);
+
+    for (byte = 0u; byte < size; byte++)
+    {
+        p_buf[byte] = (uint8_t)(byte * 7u + 1u);
+    }
+
+    for (page = 0u; page < ARRAY_SIZE(p_addrs); page++)
+    {
+        p_addrs[page] = &p_buf[page * (size / ARRAY_SIZE(p_addrs))];
+    }
+
+    present_numa_place(&numa, p_buf, size, true);
+    present_numa_query(&numa, p_addrs, nodes, ARRAY_SIZE(p_addrs));
+
+    for (page = 0u; page < ARRAY_SIZE(p_addrs); page++)
+    {
+        TEST_ASSERT_TRUE((nodes[page] < numa.node_count)
+                         || (PRESENT_NUMA_NODES_MAX == nodes[page]));
+    }
+
+    /*
+     * A skipped or a repeated chunk would break the single thread
+     * decryption.
+     */
+    TEST_ASSERT_TRUE(present_key_setup(&ctx, key_2, sizeof(key_2)));
+    TEST_ASSERT_TRUE(present_pool_init(&pool, 3u, 0u, false));
+
+    present_pool_encrypt_blocks(&pool, &ctx, p_buf, p_buf, count);
+    present_decrypt_blocks(&ctx, p_buf, p_buf, count);
+
+    for (byte = 0u; byte < size; byte++)
+    {
+        TEST_ASSERT_EQUAL_HEX8((uint8_t)(byte * 7u + 1u), p_buf[byte]);
+    }
+
+    present_pool_destroy(&pool);
+    present_numa_free(p_buf, size);
+}  /* test_numa() */
+
 /**
  * @brief Test function of the project.
  *
@@ -159,6 +1805,26 @@ int main(void)
 
     RUN_TEST(test_encrypt);
     RUN_TEST(test_decrypt);
+    RUN_TEST(test_ctx_crypt);
+    RUN_TEST(test_key_sizes);
+    RUN_TEST(test_blocks_crypt);
+    RUN_TEST(test_engines);
+    RUN_TEST(test_round_counts);
+    RUN_TEST(test_cache);
+    RUN_TEST(test_cache_threads);
+    RUN_TEST(test_ctr);
+    RUN_TEST(test_cbc);
+    RUN_TEST(test_mb);
+    RUN_TEST(test_stream);
+    RUN_TEST(test_out_of_place);
+    RUN_TEST(test_iov);
+    RUN_TEST(test_multi_key);
+    RUN_TEST(test_key_batch);
+    RUN_TEST(test_pool);
+    RUN_TEST(test_sched);
+    RUN_TEST(test_async);
+    RUN_TEST(test_async_priority);
+    RUN_TEST(test_numa);
 
     return UNITY_END();
 }  /* test_main() */